@@ -0,0 +1,123 @@
+/*
+ * Filename: alloc_tracker.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef ALLOC_TRACKER_H_
+#define ALLOC_TRACKER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Namespace containing the accounting of the heap allocations
+ *
+ * When the project is configured with -DSUDOKU_ALLOC_TRACKER=ON, the global
+ * operator new and delete are replaced by versions that count the calls and
+ * bytes of the thread that owns a Tracker, split by the phase of the search
+ * (see phase::Phase). Otherwise every function here is an empty inline and the
+ * default operators are kept
+ **/
+namespace alloc
+{
+    constexpr std::size_t SLOTS     = 8;         /**< Phases told apart */
+    constexpr uint8_t     NO_PHASE  = SLOTS - 1; /**< Slot of the allocations made
+                                                    outside of any phase */
+    constexpr std::size_t MAX_DEPTH = 4;         /**< Phases open at the same time */
+
+    /**
+     * @brief Allocations of a phase
+     */
+    struct Counts
+    {
+        uint64_t allocations; /**< Calls of operator new */
+        uint64_t frees;       /**< Calls of operator delete */
+        uint64_t bytes;       /**< Bytes allocated, as given by the allocator */
+    };
+
+    /**
+     * @brief Allocations of a solve
+     */
+    struct Stats
+    {
+        bool     enabled;       /**< The tracker was compiled in */
+        Counts   phases[SLOTS]; /**< Split by phase, NO_PHASE last */
+        Counts   total;         /**< Sum of the phases */
+        uint64_t peakLive;      /**< Highest live bytes above those of the start */
+    };
+
+#ifdef SUDOKU_ALLOC_TRACKER
+    constexpr bool ENABLED = true;
+
+    /**
+     * @brief Attribute the allocations of the calling thread to this tracker for
+     * its lifetime
+     *
+     * Trackers nest, the innermost one receives the allocations. Memory freed by
+     * another thread is not seen, and neither are the allocations of threads
+     * started during the solve
+     */
+    class Tracker
+    {
+        private:
+            Stats    m_stats;    /**< Allocations seen so far */
+            int64_t  m_live;     /**< Live bytes above those of the start */
+            Tracker* m_previous; /**< Tracker active before this one */
+
+        public:
+            Tracker();
+
+            ~Tracker();
+
+            Tracker(const Tracker&)            = delete;
+            Tracker& operator=(const Tracker&) = delete;
+
+            /**
+             * @brief Record an allocation
+             * @param bytes Size of the block
+             **/
+            void Allocated(std::size_t bytes);
+
+            /**
+             * @brief Record a release
+             * @param bytes Size of the block
+             **/
+            void Freed(std::size_t bytes);
+
+            /**
+             * @brief Get the allocations seen so far
+             * @return Counts of each phase and the peak of the live bytes
+             **/
+            Stats Read() const;
+    };
+
+    /**
+     * @brief Open a phase on the calling thread
+     * @param phase Phase, below NO_PHASE
+     **/
+    void Enter(uint8_t phase);
+
+    /**
+     * @brief Close the innermost phase of the calling thread
+     **/
+    void Leave();
+#else
+    constexpr bool ENABLED = false;
+
+    class Tracker
+    {
+        public:
+            Stats Read() const
+            {
+                return Stats { };
+            }
+    };
+
+    inline void Enter(uint8_t) { }
+
+    inline void Leave() { }
+#endif
+} // namespace alloc
+
+#endif // ALLOC_TRACKER_H_
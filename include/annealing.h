@@ -0,0 +1,189 @@
+/*
+ * Filename: annealing.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef ANNEALING_H_
+#define ANNEALING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "board.h"
+#include "topology.h"
+
+/**
+ * @brief Namespace containing the stochastic local search engine
+ **/
+namespace annealing
+{
+    constexpr std::size_t TRAJECTORY_SAMPLES = 20;   /**< Samples over the budget */
+    constexpr double      COOLING_RATE       = 0.99; /**< Temperature kept per chain */
+    constexpr std::size_t STALE_CHAINS       = 40;   /**< Chains without improvement
+                                                        before reheating */
+    constexpr double      REHEAT_FRACTION    = 0.3;  /**< Reheat temperature over the
+                                                        starting one */
+
+    /**
+     * @brief Number of conflicts at some point of the search
+     */
+    struct Sample
+    {
+        std::size_t iteration; /**< Moves tried so far */
+        uint32_t    conflicts; /**< Conflicts after those moves */
+    };
+
+    /**
+     * @brief Simulated annealing over complete assignments
+     *
+     * Every region is filled with a permutation of its missing numbers, so regions
+     * never conflict. A move swaps two free cells of the same region, and the cost
+     * is the number of repeated numbers in the other units (rows, columns and any
+     * extra unit). The count of each number in each unit is kept, so the cost of a
+     * swap is updated in O(1). The engine does not depend on GRID_SIZE and works
+     * for any box side
+     */
+    class Annealer
+    {
+        private:
+            uint16_t    m_side;  /**< Numbers per unit */
+            std::size_t m_cells; /**< Cells of the grid */
+
+            std::vector<uint8_t>  m_grid;   /**< Current assignment, row-major */
+            std::vector<uint8_t>  m_fixed;  /**< 1 for the cells given by the puzzle */
+            std::vector<uint16_t> m_region; /**< Region of each cell */
+
+            // Free cells of each region, the only ones a move may swap
+            std::vector<std::vector<uint32_t>> m_freeCells;
+
+            // Regions with at least two free cells, the only ones with moves
+            std::vector<uint16_t> m_movable;
+
+            // Scored units of each cell, m_cellUnits[m_unitStart[c]] onwards
+            std::vector<uint32_t> m_unitStart;
+            std::vector<uint16_t> m_cellUnits;
+
+            // Occurrences of each number in each scored unit, unit * side + num - 1
+            std::vector<uint16_t> m_counts;
+
+            uint32_t            m_conflicts;  /**< Current cost */
+            std::size_t         m_iterations; /**< Moves tried so far */
+            std::mt19937        m_random;     /**< Source of the moves */
+            std::vector<Sample> m_trajectory; /**< Conflicts sampled over time */
+
+            /**
+             * @brief Build the tables of the scored units and fill the regions
+             * @param extra Cells of each extra unit
+             **/
+            void Build(const std::vector<std::vector<uint32_t>>& extra);
+
+            /**
+             * @brief Fill the free cells of each region with its missing numbers,
+             * in random order
+             **/
+            void Fill();
+
+            /**
+             * @brief Place or remove a number in every scored unit of a cell
+             * @param cell Cell changed
+             * @param num Number placed or removed
+             * @param add True to place, false to remove
+             * @return Change in the number of conflicts
+             **/
+            int Count(uint32_t cell, uint8_t num, bool add);
+
+            /**
+             * @brief Swap the numbers of two cells of the same region
+             * @param a First cell
+             * @param b Second cell
+             * @return Change in the number of conflicts
+             **/
+            int Swap(uint32_t a, uint32_t b);
+
+            /**
+             * @brief Pick two distinct free cells of a random region that has moves
+             * @param a Receives the first cell
+             * @param b Receives the second cell
+             * @return False if no region has two free cells, so no move exists
+             **/
+            bool PickMove(uint32_t& a, uint32_t& b);
+
+            /**
+             * @brief Estimate the starting temperature as the standard deviation of
+             * the cost of random moves
+             * @return Starting temperature
+             **/
+            double InitialTemperature();
+
+        public:
+            /**
+             * @brief Build the engine for a classic grid of any size
+             * @param boxSide Side of a box. The grid has boxSide^2 numbers per unit
+             * @param cells Cells in row-major order, 0 meaning an empty cell
+             * @param seed Seed of the moves
+             */
+            Annealer(uint16_t                    boxSide,
+                     const std::vector<uint8_t>& cells,
+                     uint32_t                    seed);
+
+            /**
+             * @brief Build the engine for a board of some variant
+             * @param board Initial board
+             * @param topology Topology of the board
+             * @param seed Seed of the moves
+             */
+            Annealer(const grid::Board&    board,
+                     const grid::Topology& topology,
+                     uint32_t              seed);
+
+            ~Annealer();
+
+            /**
+             * @brief Anneal until there are no conflicts or the budget runs out
+             * @param budget Maximum number of moves to try
+             * @return True if a solution was found, false otherwise
+             **/
+            bool Run(std::size_t budget);
+
+            /**
+             * @brief Get the current number of conflicts
+             * @return Number of conflicts
+             **/
+            uint32_t Conflicts() const
+            {
+                return this->m_conflicts;
+            }
+
+            /**
+             * @brief Get the number of moves tried
+             * @return Number of moves
+             **/
+            std::size_t Iterations() const
+            {
+                return this->m_iterations;
+            }
+
+            /**
+             * @brief Get the current assignment
+             * @return Cells in row-major order
+             **/
+            const std::vector<uint8_t>& Cells() const
+            {
+                return this->m_grid;
+            }
+
+            /**
+             * @brief Get the conflicts sampled along the search
+             * @return Samples, the last one taken when the search stopped
+             **/
+            const std::vector<Sample>& Trajectory() const
+            {
+                return this->m_trajectory;
+            }
+    };
+} // namespace annealing
+
+#endif // ANNEALING_H_
@@ -0,0 +1,128 @@
+/*
+ * Filename: board.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef BOARD_H_
+#define BOARD_H_
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "constants.h"
+#include "topology.h"
+
+namespace grid
+{
+    constexpr std::size_t BOARD_CELLS_PADDED = 96; /**< Three 32-byte lanes */
+    constexpr uint16_t    FULL_MASK          = (1 << GRID_SIZE) - 1;
+    constexpr uint8_t     INVALID_CELL       = 0xFF; /**< Cell of a number out of
+                                                        range, never valid */
+
+    /**
+     * @brief Sudoku board stored as one byte per cell plus the masks of the numbers
+     * already used in each unit
+     *
+     * The cells are padded to a multiple of the vector width and the whole board is
+     * aligned, so copying a board compiles to a handful of vector moves. Bit
+     * (num - 1) of a mask is set when num is used in the corresponding unit. Units
+     * are numbered as in the Topology of the board, which defaults to the classic
+     * rows, columns and boxes
+     */
+    struct alignas(32) Board
+    {
+        uint8_t  cells[BOARD_CELLS_PADDED]; /**< Cells in row-major order */
+        uint16_t unitMask[MAX_UNITS];       /**< Numbers used in each unit */
+
+        /**
+         * @brief Empty every cell and mask
+         **/
+        void Clear();
+
+        /**
+         * @brief Get the number at a position
+         * @param row Row of the position
+         * @param col Column of the position
+         * @return Number at the position, 0 if the cell is empty
+         **/
+        uint16_t Get(uint16_t row, uint16_t col) const
+        {
+            return this->cells[row * GRID_SIZE + col];
+        }
+
+        /**
+         * @brief Get the mask of the numbers used in the region of a position
+         * @param row Row of the position
+         * @param col Column of the position
+         * @param topology Topology of the board
+         * @return Mask of the region
+         **/
+        uint16_t RegionMask(uint16_t        row,
+                            uint16_t        col,
+                            const Topology& topology = CLASSIC) const
+        {
+            std::size_t cell = row * GRID_SIZE + col;
+
+            return this->unitMask[REGION_UNITS + topology.region[cell]];
+        }
+
+        /**
+         * @brief Place a number in an empty position and update the masks
+         * @param row Row of the position
+         * @param col Column of the position
+         * @param num Number to place, in the range [1, GRID_SIZE]
+         * @param topology Topology of the board
+         **/
+        void Set(uint16_t        row,
+                 uint16_t        col,
+                 uint16_t        num,
+                 const Topology& topology = CLASSIC)
+        {
+            std::size_t cell = row * GRID_SIZE + col;
+            uint16_t    bit  = 1 << (num - 1);
+
+            this->cells[cell] = num;
+            this->unitMask[ROW_UNITS + row] |= bit;
+            this->unitMask[COL_UNITS + col] |= bit;
+            this->unitMask[REGION_UNITS + topology.region[cell]] |= bit;
+
+            for (uint8_t extra = topology.extraMask[cell]; extra; extra &= extra - 1)
+            {
+                this->unitMask[EXTRA_UNITS + std::countr_zero(extra)] |= bit;
+            }
+        }
+
+        /**
+         * @brief Get the numbers that can still be placed at a position
+         * @param row Row of the position
+         * @param col Column of the position
+         * @param topology Topology of the board
+         * @return Mask of the candidates
+         **/
+        uint16_t Candidates(uint16_t        row,
+                            uint16_t        col,
+                            const Topology& topology = CLASSIC) const
+        {
+            std::size_t cell = row * GRID_SIZE + col;
+            uint16_t    used = this->unitMask[ROW_UNITS + row] |
+                            this->unitMask[COL_UNITS + col] |
+                            this->unitMask[REGION_UNITS + topology.region[cell]];
+
+            for (uint8_t extra = topology.extraMask[cell]; extra; extra &= extra - 1)
+            {
+                used |= this->unitMask[EXTRA_UNITS + std::countr_zero(extra)];
+            }
+
+            return FULL_MASK & ~used;
+        }
+    };
+
+    static_assert(std::is_trivially_copyable_v<Board>,
+                  "Board must be copyable with plain moves");
+    static_assert(sizeof(Board) % 32 == 0, "Board must fill whole vector lanes");
+} // namespace grid
+
+#endif // BOARD_H_
@@ -0,0 +1,121 @@
+/*
+ * Filename: commands.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef COMMANDS_H_
+#define COMMANDS_H_
+
+#include <cstdint>
+
+#include "constants.h"
+#include "output.h"
+#include "solver.h"
+
+/**
+ * @brief Namespace containing the subcommands of the program
+ *
+ * Each subcommand receives the arguments that follow its name and returns the exit
+ * code of the program
+ **/
+namespace command
+{
+    /**
+     * @brief Validate puzzle or solution files
+     *
+     * Usage: validate [--solutions] [--variant=<name>] <file>...
+     *
+     * Every non-empty line of a file is a grid of GRID_SIZE * GRID_SIZE cells,
+     * written as digits or '.' and optionally split by spaces (as in test/inputs).
+     * One line is printed per error, followed by a summary
+     *
+     * @param argc Number of arguments
+     * @param argv Arguments
+     * @return EXIT_SUCCESS if every grid is valid, EXIT_FAILURE otherwise
+     **/
+    int Validate(int argc, char* argv[]);
+
+    /**
+     * @brief Count the complete classic grids up to symmetry
+     *
+     * Usage: enumerate [--bands=<n>] [--threads=<n>]
+     *
+     * Enumerates the canonical grids that complete the first n canonical first
+     * bands (all of them by default), and prints the count, the number of grids
+     * it stands for and, for a partial run, an estimate of the full count
+     *
+     * @param argc Number of arguments
+     * @param argv Arguments
+     * @return EXIT_SUCCESS, or EXIT_FAILURE on invalid arguments
+     **/
+    int Enumerate(int argc, char* argv[]);
+
+    /**
+     * @brief Solve a classic grid of any box side by simulated annealing
+     *
+     * Usage: anneal [--iterations=<n>] [--seed=<n>] <file>
+     *
+     * The file holds the cells of the grid in row-major order, as numbers split by
+     * blanks or line breaks, 0 or '.' meaning an empty cell. A grid with box side
+     * b has b^4 cells, so 256 cells make a 16x16 grid and 625 cells a 25x25 one.
+     * The move budget defaults to the one of the local search of the solver,
+     * scaled by the cells of the grid over those of a classic grid. The grid
+     * found, the conflicts left, the moves tried and the trajectory of the
+     * conflicts are printed
+     *
+     * @param argc Number of arguments
+     * @param argv Arguments
+     * @return EXIT_SUCCESS if a solution was found, EXIT_FAILURE otherwise
+     **/
+    int Anneal(int argc, char* argv[]);
+
+    /**
+     * @brief Run again the search recorded by --record
+     *
+     * Usage: replay <log>
+     *
+     * The puzzle, algorithm and options come from the log, and the step costs
+     * are read from it instead of drawn, so the search is the recorded one. Each
+     * decision is checked against the log, and the first mismatch is printed
+     *
+     * @param argc Number of arguments
+     * @param argv Arguments
+     * @return EXIT_SUCCESS if the search matched the log, EXIT_FAILURE otherwise
+     **/
+    int Replay(int argc, char* argv[]);
+
+    /**
+     * @brief Solve the puzzles of a file, one per line
+     *
+     * Lines are read as in Validate. In the text format each puzzle is printed by
+     * Solver::Solve, otherwise one record per puzzle is written to the standard
+     * output. The p50, p90, p99, p99.9 and max of the search times are printed to
+     * the standard error at the end, as JSON in the JSON format
+     *
+     * @param input File with the puzzles, or "-" for the standard input
+     * @param algorithm Algorithm to solve the puzzles
+     * @param options Options of the search
+     * @param format Format of the results
+     * @return EXIT_SUCCESS if every non-empty line is a grid, EXIT_FAILURE
+     * otherwise
+     **/
+    int SolveFile(const char*                  input,
+                  Algorithm                    algorithm,
+                  const sudoku::SolverOptions& options,
+                  output::Format               format);
+
+    /**
+     * @brief Solve a puzzle and write its record to the standard output
+     * @param grid Initial grid
+     * @param algorithm Algorithm to solve the puzzle
+     * @param options Options of the search
+     * @param format Format of the record, other than TEXT
+     **/
+    void WriteSolution(uint16_t                     grid[GRID_SIZE][GRID_SIZE],
+                       Algorithm                    algorithm,
+                       const sudoku::SolverOptions& options,
+                       output::Format               format);
+} // namespace command
+
+#endif // COMMANDS_H_
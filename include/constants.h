@@ -16,11 +16,13 @@ constexpr uint16_t SUBGRID_SIZE = 3;
 
 enum class Algorithm : char
 {
-    BFS    = 'B',
-    IDDFS  = 'I',
-    UCS    = 'U',
-    A_STAR = 'A',
-    GBFS   = 'G',
+    BFS       = 'B',
+    IDDFS     = 'I',
+    UCS       = 'U',
+    A_STAR    = 'A',
+    GBFS      = 'G',
+    ANNEALING = 'L',
+    PARALLEL  = 'P',
 };
 
 using State = Pair<Pair<uint16_t, uint16_t>, uint16_t>;
@@ -0,0 +1,103 @@
+/*
+ * Filename: enumeration.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef ENUMERATION_H_
+#define ENUMERATION_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "constants.h"
+#include "search_node.h"
+
+/**
+ * @brief Namespace containing the enumeration of complete classic grids
+ *
+ * Only grids in a canonical form are generated:
+ *  - The first box holds 1 to GRID_SIZE in row-major order, which removes the
+ *    relabelings of the numbers (9!)
+ *  - In the first row, each of the other stacks is ascending and the second stack
+ *    starts lower than the third, which removes the column permutations that keep
+ *    the first box in place (3! * 3! * 2 = 72)
+ *  - In the first column, each of the other bands is ascending and the second band
+ *    starts lower than the third, which removes the matching row permutations (72)
+ *
+ * Each grid has exactly one canonical form under these symmetries, so the number
+ * of grids is the canonical count times 9! * 72 * 72. Transposition and the
+ * permutations that move the first box are not factored out
+ **/
+namespace enumeration
+{
+    constexpr uint64_t RELABELINGS       = 362880; /**< 9! */
+    constexpr uint64_t LINE_PERMUTATIONS = 72;     /**< Per axis, fixing box 1 */
+    constexpr uint64_t EQUIVALENT_FORMS =
+        RELABELINGS * LINE_PERMUTATIONS * LINE_PERMUTATIONS;
+
+    using Band = std::array<uint8_t, SUBGRID_SIZE * GRID_SIZE>;
+
+    // Number of ways to fill the last band, by the numbers left in its columns
+    using BandCache = std::unordered_map<uint64_t, uint64_t>;
+
+    /**
+     * @brief Per-thread counters, one cache line each so threads never share one
+     */
+    struct alignas(sudoku::CACHE_LINE) Accumulator
+    {
+        uint64_t grids     = 0; /**< Canonical grids completed */
+        uint64_t bands     = 0; /**< First bands finished */
+        uint64_t nodes     = 0; /**< Cells assigned during the search */
+        uint64_t cacheHits = 0; /**< Last bands counted from the cache */
+    };
+
+    /**
+     * @brief Totals of an enumeration
+     */
+    struct Result
+    {
+        uint64_t grids;     /**< Canonical grids */
+        uint64_t bands;     /**< First bands enumerated */
+        uint64_t nodes;     /**< Cells assigned */
+        uint64_t cacheHits; /**< Last bands counted from the cache */
+        double   seconds;   /**< Wall time */
+    };
+
+    /**
+     * @brief Generate every canonical first band, in lexicographic order
+     * @return First bands, rows in row-major order
+     **/
+    std::vector<Band> CanonicalBands();
+
+    /**
+     * @brief Count the canonical grids that complete a first band
+     *
+     * The second band is searched cell by cell. The number of ways to fill the
+     * last band only depends on the numbers left in each column, so it is counted
+     * once per distinct set of columns and then looked up
+     *
+     * @param band First band
+     * @param cache Counts of the last bands, reused across calls of a thread
+     * @param accumulator Counters of the calling thread
+     **/
+    void
+    CountCompletions(const Band& band, BandCache& cache, Accumulator& accumulator);
+
+    /**
+     * @brief Count the canonical grids of some first bands, in parallel
+     *
+     * Threads take bands from a shared index and count into their own
+     * accumulator, which are summed at the end
+     *
+     * @param bands First bands to enumerate
+     * @param threads Number of worker threads
+     * @return Totals of the enumeration
+     **/
+    Result Enumerate(const std::vector<Band>& bands, std::size_t threads);
+} // namespace enumeration
+
+#endif // ENUMERATION_H_
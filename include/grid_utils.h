@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <iostream>
 
+#include "board.h"
 #include "constants.h"
 #include "vector.h"
 
@@ -117,6 +118,136 @@ namespace grid
      **/
     bool IsSolved(uint16_t grid[GRID_SIZE][GRID_SIZE]);
 
+    /**
+     * @brief Build a board from a grid
+     *
+     * Numbers outside [1, GRID_SIZE] are not placed, since their bit would corrupt
+     * the masks. Their cells hold INVALID_CELL instead, which the validation of the
+     * board rejects
+     *
+     * @param grid Grid to convert
+     * @param board Board that receives the cells and masks of the grid
+     * @param topology Topology of the board
+     * @return False if some number is outside [1, GRID_SIZE], true otherwise
+     **/
+    bool FromGrid(uint16_t        grid[GRID_SIZE][GRID_SIZE],
+                  Board&          board,
+                  const Topology& topology = CLASSIC);
+
+    /**
+     * @brief Write the cells of a board to a grid
+     * @param board Board to convert
+     * @param grid Grid that receives the cells of the board
+     **/
+    void ToGrid(const Board& board, uint16_t grid[GRID_SIZE][GRID_SIZE]);
+
+    /**
+     * @brief Check if the board is valid
+     * @param board Board to check
+     * @param topology Topology of the board
+     * @return True if the board is valid, false otherwise
+     **/
+    bool GridIsValid(const Board& board, const Topology& topology = CLASSIC);
+
+    /**
+     * @brief Find an empty position in the board
+     * @param board Board to find the empty position
+     * @param row Row of the empty position
+     * @param col Column of the empty position
+     * @return True if an empty position was found, false otherwise
+     **/
+    bool FindEmptyCell(const Board& board, uint16_t& row, uint16_t& col);
+
+    /**
+     * @brief Apply the changes to the board
+     * @param board Board to apply the changes
+     * @param changes Changes to apply
+     * @param topology Topology of the board
+     */
+    void ApplyChanges(Board&          board,
+                      Vector<State>&  changes,
+                      const Topology& topology = CLASSIC);
+
+    /**
+     * @brief Check if a number is in a row of the board, using its masks
+     * @param board Board to check
+     * @param row Row to check
+     * @param num Number to check, from 1 to GRID_SIZE
+     * @return True if the number is in the row, false otherwise
+     **/
+    bool IsInRow(const Board& board, uint16_t row, uint16_t num);
+
+    /**
+     * @brief Check if a number is in a column of the board, using its masks
+     * @param board Board to check
+     * @param col Column to check
+     * @param num Number to check, from 1 to GRID_SIZE
+     * @return True if the number is in the column, false otherwise
+     **/
+    bool IsInCol(const Board& board, uint16_t col, uint16_t num);
+
+    /**
+     * @brief Check if a number is in a box (or the region, for jigsaw topologies)
+     * of the board, using its masks
+     * @param board Board to check
+     * @param row Any row of the box to check
+     * @param col Any column of the box to check
+     * @param num Number to check, from 1 to GRID_SIZE
+     * @param topology Topology of the board
+     * @return True if the number is in the box, false otherwise
+     **/
+    bool IsInBox(const Board&    board,
+                 uint16_t        row,
+                 uint16_t        col,
+                 uint16_t        num,
+                 const Topology& topology = CLASSIC);
+
+    /**
+     * @brief Check if a number is valid in a position of the board
+     * @param board Board to check
+     * @param row Row to check
+     * @param col Column to check
+     * @param num Number to check, from 1 to GRID_SIZE
+     * @param topology Topology of the board, whose extra units are also checked
+     * @return True if the number is valid in the position, false otherwise or if
+     * num is out of range
+     **/
+    bool IsValid(const Board&    board,
+                 uint16_t        row,
+                 uint16_t        col,
+                 uint16_t        num,
+                 const Topology& topology = CLASSIC);
+
+    /**
+     * @brief Copy the board to a new board
+     * @param source Board to copy
+     * @param destination New board
+     */
+    void CopyGrid(const Board& source, Board& destination);
+
+    /**
+     * @brief Print the board
+     * @param board Board to print
+     **/
+    void PrintGrid(const Board& board);
+
+    void PrintGridPythonStyle(const Board& board);
+
+    /**
+     * @brief Print the subgrid of the board
+     * @param board Board to print
+     * @param row Row of the subgrid
+     * @param col Column of the subgrid
+     **/
+    void PrintSubGrid(const Board& board, uint16_t row, uint16_t col);
+
+    /**
+     * @brief Check if the current board is solved
+     * @param board Board to check
+     * @return True if the board is solved, false otherwise
+     **/
+    bool IsSolved(const Board& board);
+
 } // namespace grid
 
 #endif // GRID_UTILS_H_
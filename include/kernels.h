@@ -0,0 +1,101 @@
+/*
+ * Filename: kernels.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef KERNELS_H_
+#define KERNELS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "board.h"
+#include "constants.h"
+#include "topology.h"
+
+/**
+ * @brief Namespace containing the hot board kernels
+ *
+ * Every kernel is compiled once per instruction set (baseline, SSE4.2, AVX2 and
+ * AVX-512) and the best variant supported by the host is chosen at startup, so a
+ * single binary runs on old hosts and is fast on new ones.
+ *
+ * The variants share one scalar body each: only the compiler tells them apart.
+ * The batch validation is autovectorized into SSE, AVX2 or AVX-512 code, while
+ * propagation, validation of one board and parsing are scalar in every variant
+ * and only gain BMI and POPCNT instructions. The candidates of a single cell, as
+ * the tree searches need them, are a few ORs of the unit masks of the board (see
+ * grid::Board::Candidates) and are not dispatched
+ **/
+namespace kernel
+{
+    constexpr std::size_t LANES = 32; /**< Grids of a block of validateMany */
+
+    /**
+     * @brief Table of kernels compiled for one instruction set
+     */
+    struct Kernels
+    {
+        const char* name; /**< Name of the instruction set */
+
+        /**
+         * @brief Fill every cell that has a single candidate, until a fixpoint
+         * @param board Board to propagate
+         * @param topology Topology of the board
+         * @return Number of cells filled, or -1 if some cell ran out of candidates
+         **/
+        int (*propagate)(grid::Board& board, const grid::Topology& topology);
+
+        /**
+         * @brief Check that no unit repeats a number
+         * @param board Board to check
+         * @param topology Topology of the board
+         * @return True if the board is valid, false otherwise
+         **/
+        bool (*validate)(const grid::Board& board, const grid::Topology& topology);
+
+        /**
+         * @brief Check many packed grids, interleaved in blocks of LANES grids
+         *
+         * Byte cell * LANES + lane of a block holds that cell of the grid in that
+         * lane, so each cell of all the grids of a block is a single vector load
+         *
+         * @param cells Blocks of grids, 0 meaning an empty cell
+         * @param blocks Number of blocks
+         * @param solutions If true, every unit must be a permutation of the numbers
+         * @param topology Topology of the grids
+         * @param valid Receives 1 for each valid grid and 0 otherwise, blocks *
+         * LANES entries
+         **/
+        void (*validateMany)(const uint8_t*        cells,
+                             std::size_t           blocks,
+                             bool                  solutions,
+                             const grid::Topology& topology,
+                             uint8_t*              valid);
+
+        /**
+         * @brief Parse GRID_SIZE * GRID_SIZE digits, in row-major order
+         * @param text Digits to parse, '0' or '.' meaning an empty cell
+         * @param topology Topology of the board
+         * @param board Board that receives the cells and masks
+         * @return True if every character is a valid cell, false otherwise
+         **/
+        bool (*parse)(const char*           text,
+                      const grid::Topology& topology,
+                      grid::Board&          board);
+    };
+
+    /**
+     * @brief Get the kernels for the best instruction set of the host
+     *
+     * Resolved once, on the first call. The environment variable SUDOKU_KERNEL
+     * (generic, sse4.2, avx2 or avx512) forces a lower variant, which is useful to
+     * compare them on the same host
+     *
+     * @return Table of kernels
+     **/
+    const Kernels& Active();
+} // namespace kernel
+
+#endif // KERNELS_H_
@@ -0,0 +1,141 @@
+/*
+ * Filename: latency.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef LATENCY_H_
+#define LATENCY_H_
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/**
+ * @brief Namespace containing the latency histograms of the batch runs
+ *
+ * The histograms follow the layout of HdrHistogram: values below SUB_BUCKETS
+ * nanoseconds have a bucket each, and every power of two above is split into
+ * SUB_BUCKETS / 2 buckets of the same width, so a percentile is off by less than
+ * 1 / (SUB_BUCKETS / 2) of its value for any latency up to 2^64 ns
+ **/
+namespace latency
+{
+    constexpr unsigned    SUB_BITS    = 8;             /**< Precision of a bucket */
+    constexpr std::size_t SUB_BUCKETS = 1 << SUB_BITS; /**< Buckets of [0, 256) */
+    constexpr std::size_t HALF        = SUB_BUCKETS / 2;
+    constexpr std::size_t BUCKETS     = SUB_BUCKETS + (64 - SUB_BITS) * HALF;
+
+    /**
+     * @brief Percentiles reported for a histogram, in nanoseconds
+     */
+    struct Percentiles
+    {
+        uint64_t count; /**< Values recorded */
+        uint64_t p50;   /**< Median */
+        uint64_t p90;   /**< 90th percentile */
+        uint64_t p99;   /**< 99th percentile */
+        uint64_t p999;  /**< 99.9th percentile */
+        uint64_t max;   /**< Largest value, exact */
+        double   mean;  /**< Average value, exact */
+    };
+
+    /**
+     * @brief Histogram of latencies with a single writer
+     *
+     * Recording is a few shifts and an increment, with no atomics and no locks.
+     * Each worker keeps its own histogram and the histograms are merged once the
+     * workers are done
+     */
+    class Histogram
+    {
+        private:
+            std::vector<uint64_t> m_counts; /**< Values per bucket */
+            uint64_t              m_total;  /**< Values recorded */
+            uint64_t              m_max;    /**< Largest value */
+            double                m_sum;    /**< Sum of the values, for the mean */
+
+            /**
+             * @brief Get the bucket of a value
+             * @param value Value in nanoseconds
+             * @return Index of its bucket
+             **/
+            static std::size_t Bucket(uint64_t value)
+            {
+                if (value < SUB_BUCKETS)
+                    return value;
+
+                // The top SUB_BITS bits of the value, of which the first is 1
+                unsigned shift = std::bit_width(value) - SUB_BITS;
+
+                return SUB_BUCKETS + (shift - 1) * HALF + ((value >> shift) - HALF);
+            }
+
+            /**
+             * @brief Get the largest value of a bucket
+             * @param bucket Index of the bucket
+             * @return Largest value that falls in the bucket
+             **/
+            static uint64_t Highest(std::size_t bucket);
+
+        public:
+            Histogram();
+
+            /**
+             * @brief Record a value
+             * @param nanoseconds Latency to record
+             **/
+            void Record(uint64_t nanoseconds)
+            {
+                this->m_counts[Bucket(nanoseconds)]++;
+                this->m_total++;
+                this->m_sum += nanoseconds;
+
+                if (nanoseconds > this->m_max)
+                    this->m_max = nanoseconds;
+            }
+
+            /**
+             * @brief Add the values of another histogram
+             * @param other Histogram to add, of another worker or group
+             **/
+            void Merge(const Histogram& other);
+
+            /**
+             * @brief Get the number of values recorded
+             * @return Values recorded
+             **/
+            uint64_t Count() const
+            {
+                return this->m_total;
+            }
+
+            /**
+             * @brief Get the value at a percentile
+             *
+             * The value is the largest of its bucket, capped by the largest value
+             * recorded, so percentiles are never below the true ones
+             *
+             * @param percentile Percentile, from 0 to 100
+             * @return Value in nanoseconds, 0 if the histogram is empty
+             **/
+            uint64_t Percentile(double percentile) const;
+
+            /**
+             * @brief Get the percentiles of the report
+             * @return p50, p90, p99, p99.9, max and mean
+             **/
+            Percentiles Summary() const;
+    };
+
+    /**
+     * @brief Write the percentiles of a histogram as a JSON object
+     * @param file Destination
+     * @param summary Percentiles to write
+     **/
+    void WriteJson(std::FILE* file, const Percentiles& summary);
+} // namespace latency
+
+#endif // LATENCY_H_
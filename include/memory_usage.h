@@ -0,0 +1,116 @@
+/*
+ * Filename: memory_usage.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef MEMORY_USAGE_H_
+#define MEMORY_USAGE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Namespace containing the accounting of the memory of a search
+ *
+ * Each structure of the tree searches is measured by the bytes it holds at its
+ * peak, sampled at every expansion, and by the capacity it reserved, which never
+ * shrinks during a search. The open list is measured by its largest size times
+ * the bytes of an entry. The peak total is then compared with the growth of the
+ * resident memory of the process, so the slack of the allocator and the memory
+ * outside of the search show up as the difference
+ **/
+namespace memory
+{
+    /**
+     * @brief Structure of a search
+     */
+    enum Component : uint8_t
+    {
+        NODES,      /**< Node headers: priorities, depth, move and parent */
+        BOARDS,     /**< Board payloads of the live nodes */
+        FREE_LIST,  /**< Payload slots waiting for reuse */
+        FRONTIER,   /**< Entries of the open list */
+        CHILDREN,   /**< Buffer of the children of an expansion */
+        COMPONENTS  /**< Number of components */
+    };
+
+    /**
+     * @brief Entry of the linked queue and stack of BFS and IDDFS: the index of
+     * the node and the link to the next entry
+     */
+    struct Link
+    {
+        uint32_t id;   /**< Index of the node */
+        Link*    next; /**< Next entry */
+    };
+
+    constexpr std::size_t LINK_BYTES = sizeof(Link);     /**< Linked frontiers */
+    constexpr std::size_t KEY_BYTES  = sizeof(uint64_t); /**< Priority frontiers */
+
+    /**
+     * @brief Memory of a solve
+     */
+    struct Usage
+    {
+        bool     enabled;              /**< The search was accounted */
+        uint64_t bytes[COMPONENTS];    /**< Peak bytes in use by each component */
+        uint64_t reserved[COMPONENTS]; /**< Bytes reserved by each component */
+        uint64_t frontier;             /**< Most nodes in the open list */
+        uint64_t rssBefore;            /**< Peak resident memory before the
+                                          search, in KiB */
+        uint64_t rssAfter;             /**< Peak resident memory after the search,
+                                          in KiB */
+
+        /**
+         * @brief Raise the peak of a component
+         * @param component Component measured
+         * @param size Bytes it holds now
+         **/
+        void Peak(Component component, uint64_t size)
+        {
+            this->bytes[component] = std::max(this->bytes[component], size);
+        }
+
+        /**
+         * @brief Get the sum of the peaks of the components
+         * @return Bytes accounted
+         **/
+        uint64_t Total() const;
+
+        /**
+         * @brief Get the sum of the bytes reserved by the components
+         * @return Bytes reserved
+         **/
+        uint64_t Reserved() const;
+
+        /**
+         * @brief Get the bytes accounted per node of the largest open list
+         * @return Bytes per frontier node, 0 if nothing entered the open list
+         **/
+        double BytesPerFrontierNode() const;
+    };
+
+    /**
+     * @brief Get the name of a component
+     * @param component Component to name
+     * @return Name of the component, in lowercase
+     **/
+    const char* ComponentName(Component component);
+
+    /**
+     * @brief Get the peak resident memory of the process
+     * @return Peak memory in KiB, which is the unit of ru_maxrss on Linux
+     **/
+    uint64_t PeakRss();
+
+    /**
+     * @brief Print the peak of each component, the bytes per frontier node and
+     * the check against the resident memory
+     * @param usage Memory of the solve
+     **/
+    void Print(const Usage& usage);
+} // namespace memory
+
+#endif // MEMORY_USAGE_H_
@@ -0,0 +1,295 @@
+/*
+ * Filename: observer.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef OBSERVER_H_
+#define OBSERVER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "board.h"
+
+#include "memory_usage.h"
+#include "probes.h"
+#include "progress.h"
+#include "search_log.h"
+#include "search_node.h"
+#include "time_series.h"
+#include "topology.h"
+#include "trace.h"
+#include "tree_shape.h"
+
+/**
+ * @brief Namespace containing the observers of the tree searches
+ *
+ * An observer is a policy of the search loops: the loops are templates on its
+ * type and call its members at each event, so the compiler inlines the calls.
+ * NullObserver has only empty members and leaves the plain loops. Any type with
+ * the same members can be passed instead
+ **/
+namespace observe
+{
+    /**
+     * @brief Check if a tracer is attached to a probe of the search loops
+     * @return True if any of the probes fired by Instruments is enabled
+     **/
+    inline bool ProbesAttached()
+    {
+        return SUDOKU_PROBE_ENABLED(expand) or SUDOKU_PROBE_ENABLED(push) or
+               SUDOKU_PROBE_ENABLED(pop) or SUDOKU_PROBE_ENABLED(propagate) or
+               SUDOKU_PROBE_ENABLED(goal);
+    }
+
+    /**
+     * @brief Why a node is left without being expanded further
+     */
+    enum Backtrack : uint8_t
+    {
+        DEAD_END, /**< The node has no valid children */
+        CUTOFF    /**< The node is at the depth limit of IDDFS */
+    };
+
+    /**
+     * @brief Observer that compiles out
+     */
+    struct NullObserver
+    {
+        /**
+         * @brief A node entered the open list
+         * @param id Index of the node
+         * @param frontier Nodes in the open list, including it
+         **/
+        void OnPush(uint32_t, std::size_t) { }
+
+        /**
+         * @brief A node left the open list
+         * @param id Index of the node
+         * @param frontier Nodes in the open list, without it
+         **/
+        void OnPop(uint32_t, std::size_t) { }
+
+        /**
+         * @brief A node is about to be expanded
+         * @param id Index of the node
+         * @param node The node
+         * @param expansions Expansions so far, including this one
+         * @param frontier Nodes in the open list
+         **/
+        void OnExpand(uint32_t, const sudoku::SearchNode&, std::size_t, std::size_t)
+        { }
+
+        /**
+         * @brief The expanded node branches on a cell
+         * @param board Board of the expanded node
+         * @param row Row of the cell
+         * @param col Column of the cell
+         **/
+        void OnChoose(const grid::Board&, uint16_t, uint16_t) { }
+
+        /**
+         * @brief A child was added to the search
+         * @param parent Index of the expanded node
+         * @param child Index of the child
+         * @param num Number placed by the child
+         **/
+        void OnGenerate(uint32_t, uint32_t, uint16_t) { }
+
+        /**
+         * @brief Propagation ran on a node
+         * @param id Index of the node
+         * @param filled Cells filled, negative if the node has no solution
+         **/
+        void OnPropagate(uint32_t, int) { }
+
+        /**
+         * @brief A child was discarded because propagation emptied a cell
+         * @param parent Index of the expanded node
+         * @param num Number placed by the child
+         **/
+        void OnPrune(uint32_t, uint16_t) { }
+
+        /**
+         * @brief A node is left without children
+         * @param id Index of the node
+         * @param depth Depth of the node
+         * @param reason Why it has no children
+         **/
+        void OnBacktrack(uint32_t, uint16_t, Backtrack) { }
+
+        /**
+         * @brief IDDFS starts over with a new depth limit
+         * @param limit Depth limit
+         **/
+        void OnDeepen(std::size_t) { }
+
+        /**
+         * @brief A solution was found
+         * @param id Index of the solution
+         * @param depth Depth of the solution
+         * @param expansions Expansions so far
+         **/
+        void OnGoal(uint32_t, uint16_t, std::size_t) { }
+    };
+
+    /**
+     * @brief Observer that feeds the instruments of the solver: the USDT probes,
+     * the heartbeat counters, the time series, the trace, the search log, the
+     * histograms of the tree and the memory accounting
+     *
+     * Each instrument still checks on its own whether it is on, so the solver
+     * only runs this observer when at least one of them may be
+     */
+    class Instruments
+    {
+        private:
+            const sudoku::NodeStore& m_nodes;    /**< Node store of the search */
+            const grid::Topology&    m_topology; /**< Units of the puzzle */
+            progress::Counters&      m_progress; /**< Read by the heartbeat */
+            series::Recorder&        m_series;   /**< Growth of the search */
+            trace::Burst&            m_burst;    /**< Expansions in the trace */
+            searchlog::Log*          m_log;      /**< Decisions, or nullptr */
+            shape::Histograms*       m_shape;    /**< Histograms, or nullptr */
+            memory::Usage*           m_memory;   /**< Accounting, or nullptr */
+            std::size_t              m_depth;    /**< Of the node being expanded */
+
+        public:
+            Instruments(const sudoku::NodeStore& nodes,
+                        const grid::Topology&    topology,
+                        progress::Counters&      progress,
+                        series::Recorder&        recorder,
+                        trace::Burst&            burst,
+                        searchlog::Log*          log,
+                        shape::Histograms*       histograms,
+                        memory::Usage*           usage)
+                : m_nodes(nodes),
+                  m_topology(topology),
+                  m_progress(progress),
+                  m_series(recorder),
+                  m_burst(burst),
+                  m_log(log),
+                  m_shape(histograms),
+                  m_memory(usage),
+                  m_depth(0)
+            { }
+
+            void OnPush(uint32_t id, std::size_t frontier)
+            {
+                SUDOKU_PROBE2(push, id, frontier);
+
+                if (this->m_memory != nullptr)
+                    this->m_memory->frontier =
+                        std::max<uint64_t>(this->m_memory->frontier, frontier);
+            }
+
+            void OnPop(uint32_t id, std::size_t frontier)
+            {
+                SUDOKU_PROBE2(pop, id, frontier);
+            }
+
+            void OnExpand(uint32_t                  id,
+                          const sudoku::SearchNode& node,
+                          std::size_t               expansions,
+                          std::size_t               frontier)
+            {
+                this->m_burst.Tick();
+
+                // Relaxed stores, only read by the heartbeat thread
+                progress::Counters& counters = this->m_progress;
+
+                counters.expansions.store(expansions, std::memory_order_relaxed);
+                counters.frontier.store(frontier, std::memory_order_relaxed);
+                counters.depth.store(node.depth, std::memory_order_relaxed);
+                counters.f.store(node.f, std::memory_order_relaxed);
+
+                SUDOKU_PROBE4(expand, id, node.depth, node.f, frontier);
+
+                if (this->m_series.Due(expansions))
+                    this->m_series.Record(expansions,
+                                          frontier,
+                                          this->m_nodes.LiveNodes(),
+                                          this->m_nodes.Bytes());
+
+                this->m_depth = std::min<std::size_t>(node.depth, shape::DEPTHS - 1);
+
+                if (this->m_shape != nullptr)
+                    this->m_shape->nodes[this->m_depth]++;
+
+                if (this->m_memory != nullptr)
+                    this->Account();
+            }
+
+            /**
+             * @brief Raise the peaks of the node store to what it holds now
+             **/
+            void Account()
+            {
+                const sudoku::NodeStore& nodes = this->m_nodes;
+
+                this->m_memory->Peak(memory::NODES,
+                                     nodes.Size() * sizeof(sudoku::SearchNode));
+                this->m_memory->Peak(memory::BOARDS,
+                                     nodes.Payloads() * sizeof(grid::Board));
+                this->m_memory->Peak(memory::FREE_LIST,
+                                     nodes.FreePayloads() * sizeof(uint32_t));
+            }
+
+            void OnChoose(const grid::Board& board, uint16_t row, uint16_t col)
+            {
+                if (this->m_log != nullptr)
+                    this->m_log->Expand(row, col);
+
+                if (this->m_shape != nullptr)
+                    this->m_shape->candidates[std::popcount(
+                        board.Candidates(row, col, this->m_topology))]++;
+            }
+
+            void OnGenerate(uint32_t, uint32_t, uint16_t)
+            {
+                if (this->m_shape != nullptr)
+                    this->m_shape->children[this->m_depth]++;
+            }
+
+            void OnPropagate(uint32_t id, int filled)
+            {
+                SUDOKU_PROBE2(propagate, id, filled);
+            }
+
+            void OnPrune(uint32_t, uint16_t num)
+            {
+                if (this->m_log != nullptr)
+                    this->m_log->Event(searchlog::PRUNE, num);
+            }
+
+            void OnBacktrack(uint32_t, uint16_t depth, Backtrack reason)
+            {
+                if (this->m_shape != nullptr and reason == DEAD_END)
+                    this->m_shape->deadEnds[std::min<std::size_t>(
+                        depth, shape::DEPTHS - 1)]++;
+
+                if (this->m_log != nullptr)
+                    this->m_log->Event(reason == CUTOFF ? searchlog::CUTOFF
+                                                        : searchlog::DEAD_END);
+            }
+
+            void OnDeepen(std::size_t limit)
+            {
+                this->m_progress.limit.store(limit, std::memory_order_relaxed);
+            }
+
+            void OnGoal(uint32_t id, uint16_t depth, std::size_t expansions)
+            {
+                SUDOKU_PROBE3(goal, id, depth, expansions);
+
+                if (this->m_log != nullptr)
+                    this->m_log->Event(searchlog::GOAL);
+            }
+    };
+} // namespace observe
+
+#endif // OBSERVER_H_
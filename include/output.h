@@ -0,0 +1,162 @@
+/*
+ * Filename: output.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef OUTPUT_H_
+#define OUTPUT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "board.h"
+#include "memory_usage.h"
+#include "phase_timers.h"
+
+/**
+ * @brief Namespace containing the machine-readable output of the solver
+ *
+ * Every format writes one record per puzzle:
+ *  - JSON: one object per line (JSON Lines)
+ *  - CSV: a header line, then one row per puzzle
+ *  - Compact: the fields of the CSV, separated by spaces and without header
+ **/
+namespace output
+{
+    constexpr std::size_t BUFFER_SIZE = 1 << 16; /**< Bytes kept before a write */
+
+    /**
+     * @brief Formats of the results
+     */
+    enum class Format
+    {
+        TEXT,   /**< Human-readable, printed by Solver::Solve */
+        JSON,   /**< JSON Lines */
+        CSV,    /**< Comma-separated values with a header */
+        COMPACT /**< Space-separated values */
+    };
+
+    /**
+     * @brief Outcome of a puzzle
+     */
+    enum class Status
+    {
+        SOLVED,    /**< A solution was found */
+        UNSOLVED,  /**< The search ended without a solution */
+        INVALID,   /**< The puzzle repeats a number in some unit */
+        MALFORMED  /**< The line is not a grid */
+    };
+
+    /**
+     * @brief Result of one puzzle
+     */
+    struct Record
+    {
+        std::size_t             index;       /**< Position of the puzzle, from 0 */
+        Status                  status;      /**< Outcome of the puzzle */
+        const char*             algorithm;   /**< Name of the algorithm */
+        const grid::Board*      solution;    /**< Solved board, nullptr if none */
+        uint64_t                searchNs;    /**< Time of the search */
+        uint64_t                totalNs;     /**< Time of the setup and the search */
+        uint64_t                expanded;    /**< Nodes expanded */
+        uint64_t                generated;   /**< Children generated */
+        uint64_t                propagated;  /**< Cells filled by propagation */
+        uint64_t                moves;       /**< Moves of the local search */
+        uint64_t                processPeak; /**< Peak resident memory of the
+                                                whole process so far, in KiB.
+                                                Not a figure of this puzzle:
+                                                it only grows across a batch */
+        const phase::Breakdown* phases;      /**< Time per phase, only written as
+                                                JSON. nullptr unless built with
+                                                SUDOKU_PHASE_TIMERS */
+        const memory::Usage*    memory;      /**< Peak bytes per structure, only
+                                                written as JSON. nullptr unless
+                                                solved with --memory */
+    };
+
+    /**
+     * @brief Find a format by name
+     * @param name text, json, csv or compact
+     * @param format Receives the format
+     * @return True if the name is known
+     **/
+    bool ParseFormat(const char* name, Format& format);
+
+    /**
+     * @brief Get the name of a status, as written in the records
+     * @param status Status to name
+     * @return Name of the status
+     **/
+    const char* StatusName(Status status);
+
+    /**
+     * @brief Buffered writer of a stream
+     *
+     * Text is copied into a fixed buffer and written with a single fwrite when the
+     * buffer fills up, so formatting a record never waits on the stream
+     */
+    class Writer
+    {
+        private:
+            std::FILE*  m_file;                /**< Destination of the text */
+            std::size_t m_used;                /**< Bytes waiting in the buffer */
+            char        m_buffer[BUFFER_SIZE]; /**< Text not written yet */
+
+        public:
+            Writer(std::FILE* file);
+
+            /**
+             * @brief Destructor. Writes what is left in the buffer
+             **/
+            ~Writer();
+
+            /**
+             * @brief Append text
+             * @param text Text to append
+             * @param length Number of bytes of the text
+             **/
+            void Write(const char* text, std::size_t length);
+
+            /**
+             * @brief Append a null-terminated string
+             * @param text String to append
+             **/
+            void Write(const char* text);
+
+            /**
+             * @brief Append a character
+             * @param c Character to append
+             **/
+            void Write(char c);
+
+            /**
+             * @brief Append an unsigned integer in decimal
+             * @param value Value to append
+             **/
+            void WriteNumber(uint64_t value);
+
+            /**
+             * @brief Write the buffer to the stream
+             **/
+            void Flush();
+    };
+
+    /**
+     * @brief Write what comes before the first record, if anything
+     * @param writer Destination
+     * @param format Format of the records
+     **/
+    void WriteHeader(Writer& writer, Format format);
+
+    /**
+     * @brief Write a record
+     * @param writer Destination
+     * @param format Format of the record, other than TEXT
+     * @param record Record to write
+     **/
+    void WriteRecord(Writer& writer, Format format, const Record& record);
+} // namespace output
+
+#endif // OUTPUT_H_
@@ -0,0 +1,216 @@
+/*
+ * Filename: parallel_search.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef PARALLEL_SEARCH_H_
+#define PARALLEL_SEARCH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "board.h"
+#include "progress.h"
+#include "topology.h"
+#include "tree_shape.h"
+
+namespace sudoku
+{
+    constexpr std::size_t SPLIT_NODES = 64; /**< Subtrees wanted from the split */
+    constexpr std::size_t NO_SUBTREE  = SIZE_MAX;
+
+    /**
+     * @brief Options of the parallel depth-first search
+     */
+    struct ParallelOptions
+    {
+        std::size_t           threads;       /**< Worker threads */
+        bool                  deterministic; /**< Results independent of timing */
+        bool                  propagate;     /**< Fill single-candidate cells */
+        const grid::Topology* topology;      /**< Units of the puzzle */
+        progress::Counters*   progress;      /**< Subtrees done, or nullptr */
+        bool                  histograms;    /**< Collect the shape of the tree */
+    };
+
+    /**
+     * @brief Work distribution counters of a parallel search
+     */
+    struct ParallelStats
+    {
+        std::size_t subtrees;   /**< Subtrees produced by the split */
+        std::size_t searched;   /**< Subtrees searched. Deterministic runs count
+                                   only those up to the winner */
+        std::size_t offHome;    /**< Subtrees run by a thread other than their home
+                                   thread (index modulo the number of threads).
+                                   All threads take from one shared index, so this
+                                   only shows how far the order of the takes is
+                                   from round robin, not any stealing */
+        std::size_t contention; /**< Failed updates of the shared winner */
+        std::size_t winner;     /**< Subtree that gave the solution, or NO_SUBTREE */
+        uint64_t    cpus;       /**< Mask of the CPUs the threads ran on. CPUs past
+                                   63 share the last bit */
+    };
+
+    /**
+     * @brief Depth-first search split into ordered subtrees run by a thread pool
+     *
+     * The root is expanded breadth-first until there are at least SPLIT_NODES
+     * nodes, which depends only on the puzzle. Those nodes, in generation order,
+     * are the subtrees. Threads take subtrees from a shared index and search each
+     * one depth-first, trying the numbers in increasing order.
+     *
+     * In deterministic mode the winner is the lowest subtree that has a solution:
+     * subtrees past a known solution are skipped, but every earlier one is
+     * searched. The solution and the reported counts are those of a sequential
+     * search of the subtrees in order, so they are identical for any number of
+     * threads. Otherwise the first solution found by any thread wins and the
+     * counts cover the work actually done
+     */
+    class ParallelDFS
+    {
+        private:
+            /**
+             * @brief Outcome of the search of one subtree
+             */
+            struct Subtree
+            {
+                grid::Board board;          /**< Root of the subtree */
+                grid::Board solution;       /**< Solution found, if any */
+                bool        solved;         /**< A solution was found */
+                std::size_t expandedStates; /**< Children generated */
+                std::size_t propagated;     /**< Cells filled by propagation */
+
+                shape::Histograms shape; /**< Only filled with histograms on */
+            };
+
+            ParallelOptions      m_options;
+            std::vector<Subtree> m_subtrees;
+
+            // Split phase, or the whole search if it ended there
+            std::size_t       m_splitExpanded;
+            std::size_t       m_splitPropagated;
+            std::size_t       m_splitDepth; /**< Depth of the subtree roots */
+            shape::Histograms m_splitShape;
+
+            std::size_t   m_expandedStates; /**< Children generated, see class doc */
+            std::size_t   m_propagated;     /**< Cells filled by propagation */
+            ParallelStats     m_stats;
+            grid::Board       m_solution;
+            shape::Histograms m_shape; /**< Same subtrees as m_expandedStates */
+
+            std::atomic<std::size_t> m_next;       /**< Next subtree to hand out */
+            std::atomic<std::size_t> m_winner;     /**< Best subtree with a solution */
+            std::atomic<std::size_t> m_started;    /**< Subtrees taken by a thread */
+            std::atomic<std::size_t> m_offHome;    /**< See ParallelStats */
+            std::atomic<std::size_t> m_contention; /**< See ParallelStats */
+            std::atomic<uint64_t>    m_cpus;       /**< See ParallelStats */
+
+            /**
+             * @brief Generate the children of a board at its first empty cell
+             * @param board Board to expand
+             * @param children Receives the children
+             * @param propagated Incremented with the cells filled by propagation
+             * @param candidates Receives the numbers the chosen cell accepts
+             * @return Number of children
+             **/
+            std::size_t Expand(const grid::Board& board,
+                               grid::Board        children[GRID_SIZE],
+                               std::size_t&       propagated,
+                               std::size_t&       candidates);
+
+            /**
+             * @brief Search a subtree depth-first
+             * @param board Board of the current node
+             * @param depth Depth of the current node from the root of the puzzle
+             * @param index Index of the subtree, to check if it is still needed
+             * @param subtree Receives the outcome and counts
+             * @return True if a solution was found, false otherwise
+             **/
+            bool Search(const grid::Board& board,
+                        std::size_t        depth,
+                        std::size_t        index,
+                        Subtree&           subtree);
+
+            /**
+             * @brief Expand the root breadth-first into the subtrees
+             * @param root Initial board
+             * @return True if the split itself reached a solution
+             **/
+            bool Split(const grid::Board& root);
+
+            /**
+             * @brief Take subtrees from the shared index until none is left
+             * @param thread Index of the calling thread
+             **/
+            void Work(std::size_t thread);
+
+            /**
+             * @brief Record that a subtree has a solution
+             * @param index Index of the subtree
+             **/
+            void Claim(std::size_t index);
+
+        public:
+            ParallelDFS(const ParallelOptions& options);
+
+            ~ParallelDFS();
+
+            /**
+             * @brief Solve a board
+             * @param root Initial board, which must not be solved already
+             * @return True if a solution was found, false otherwise
+             **/
+            bool Run(const grid::Board& root);
+
+            /**
+             * @brief Get the solution of the last run
+             * @return Solved board
+             **/
+            const grid::Board& Solution() const
+            {
+                return this->m_solution;
+            }
+
+            /**
+             * @brief Get the number of children generated
+             * @return Expanded states
+             **/
+            std::size_t ExpandedStates() const
+            {
+                return this->m_expandedStates;
+            }
+
+            /**
+             * @brief Get the number of cells filled by propagation
+             * @return Propagated cells
+             **/
+            std::size_t Propagated() const
+            {
+                return this->m_propagated;
+            }
+
+            /**
+             * @brief Get the histograms of the tree, merged over the threads
+             * @return Histograms of the counted subtrees and of the split, empty
+             * unless ParallelOptions::histograms is set
+             **/
+            const shape::Histograms& Shape() const
+            {
+                return this->m_shape;
+            }
+
+            /**
+             * @brief Get the work distribution counters
+             * @return Counters of the last run
+             **/
+            const ParallelStats& Stats() const
+            {
+                return this->m_stats;
+            }
+    };
+} // namespace sudoku
+
+#endif // PARALLEL_SEARCH_H_
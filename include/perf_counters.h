@@ -0,0 +1,95 @@
+/*
+ * Filename: perf_counters.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef PERF_COUNTERS_H_
+#define PERF_COUNTERS_H_
+
+#include <cstdint>
+
+/**
+ * @brief Namespace containing wrappers around the hardware performance counters
+ **/
+namespace perf
+{
+    /**
+     * @brief Events of a CounterGroup
+     */
+    enum Event : uint8_t
+    {
+        CYCLES,        /**< CPU cycles */
+        INSTRUCTIONS,  /**< Instructions retired */
+        L1D_MISSES,    /**< L1d read misses */
+        LLC_MISSES,    /**< Last level cache misses */
+        BRANCH_MISSES, /**< Mispredicted branches */
+        DTLB_MISSES,   /**< dTLB read misses */
+        EVENTS         /**< Number of events */
+    };
+
+    /**
+     * @brief Counts of the events of a CounterGroup
+     */
+    struct Sample
+    {
+        uint64_t values[EVENTS];    /**< Counts, scaled up if the group was
+                                       multiplexed */
+        bool     available[EVENTS]; /**< The event could be opened */
+    };
+
+    /**
+     * @brief Get the name of an event
+     * @param event Event to name
+     * @return Name of the event, in lowercase
+     **/
+    const char* EventName(Event event);
+
+    /**
+     * @brief Counts the events of the calling thread as a single perf_event group
+     *
+     * The events are scheduled together, so ratios such as instructions per cycle
+     * come from the same interval. Events the kernel or the CPU do not allow are
+     * left out of the group and read as unavailable; if the group is multiplexed
+     * with other users of the PMU, the counts are scaled by the time it ran
+     */
+    class CounterGroup
+    {
+        private:
+            int m_fds[EVENTS]; /**< File descriptor of each event, or -1 */
+            int m_leader;      /**< Descriptor of the group leader, or -1 */
+            int m_count;       /**< Events in the group */
+
+        public:
+            CounterGroup();
+
+            ~CounterGroup();
+
+            CounterGroup(const CounterGroup&)            = delete;
+            CounterGroup& operator=(const CounterGroup&) = delete;
+
+            /**
+             * @brief Check if at least one event could be opened
+             * @return True if the group is available, false otherwise
+             **/
+            bool IsAvailable() const;
+
+            /**
+             * @brief Reset and start counting
+             **/
+            void Start();
+
+            /**
+             * @brief Stop counting
+             **/
+            void Stop();
+
+            /**
+             * @brief Read the counts between Start and Stop
+             * @return Counts of the events, zero for the unavailable ones
+             **/
+            Sample Read() const;
+    };
+} // namespace perf
+
+#endif // PERF_COUNTERS_H_
@@ -0,0 +1,282 @@
+/*
+ * Filename: phase_timers.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef PHASE_TIMERS_H_
+#define PHASE_TIMERS_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "alloc_tracker.h"
+
+/**
+ * @brief Namespace containing the timers of the phases of the tree searches
+ *
+ * The timers are a policy of the solver: Timers<false> has only empty inline
+ * members, so the instrumentation compiles out completely. Timers<true> is
+ * selected when the project is configured with -DSUDOKU_PHASE_TIMERS=ON
+ **/
+namespace phase
+{
+    constexpr uint64_t    SAMPLE_PERIOD = 16; /**< Iterations per timed iteration */
+    constexpr std::size_t MAX_DEPTH     = 4;  /**< Phases open at the same time */
+
+    /**
+     * @brief Phases of an iteration of the search loop
+     */
+    enum Phase : uint8_t
+    {
+        BOARD,     /**< Copies of boards into the node store */
+        EXPAND,    /**< Rest of ExpandNode: cell choice, checks and propagation */
+        CHECK,     /**< CheckSolution */
+        HEURISTIC, /**< Heuristic of A* and GBFS */
+        FRONTIER,  /**< Push and pop of the frontier */
+        RELEASE,   /**< Release of the boards of visited nodes */
+        PHASES     /**< Number of phases */
+    };
+
+    static_assert(PHASES <= alloc::NO_PHASE, "Every phase needs an allocation slot");
+
+    /**
+     * @brief Time and calls of each phase of a search
+     */
+    struct Breakdown
+    {
+        bool     enabled;             /**< The timers were compiled in */
+        uint64_t nanoseconds[PHASES]; /**< Estimated from the timed iterations */
+        uint64_t calls[PHASES];       /**< Calls of each phase, exact */
+        uint64_t iterations;          /**< Iterations of the search loop */
+        uint64_t sampled;             /**< Iterations that were timed */
+    };
+
+    /**
+     * @brief Get the name of a phase
+     * @param phase Phase to name
+     * @return Name of the phase, in lowercase
+     **/
+    const char* PhaseName(Phase phase);
+
+    /**
+     * @brief Timers of the phases
+     * @tparam Enabled False for the policy that compiles out
+     */
+    template<bool Enabled>
+    class Timers
+    {
+        public:
+            void Reset() { }
+
+            void Iteration() { }
+
+            void Start(Phase) { }
+
+            void Stop() { }
+
+            Breakdown Read() const
+            {
+                return Breakdown { };
+            }
+    };
+
+    /**
+     * @brief Timers of the phases that measure
+     *
+     * Calls are always counted, but only one iteration in SAMPLE_PERIOD reads the
+     * clock, and the time of the others is extrapolated. Phases may nest, and the
+     * time of an inner phase is not counted in the outer one
+     */
+    template<>
+    class Timers<true>
+    {
+        private:
+            using Clock = std::chrono::steady_clock;
+
+            uint64_t m_sampledNs[PHASES]; /**< Time of the timed iterations */
+            uint64_t m_calls[PHASES];     /**< Calls of each phase */
+            uint64_t m_iterations;        /**< Iterations of the search loop */
+            uint64_t m_sampled;           /**< Iterations that were timed */
+            bool     m_timing;            /**< The current iteration is timed */
+
+            Phase             m_open[MAX_DEPTH]; /**< Phases open, innermost last */
+            std::size_t       m_depth;           /**< Number of phases open */
+            Clock::time_point m_mark;            /**< Last time read */
+            uint64_t          m_clockCost;       /**< See ClockCost */
+
+            /**
+             * @brief Measure the cost of a read of the clock, once per process
+             * @return Average nanoseconds of a read
+             **/
+            static uint64_t ClockCost()
+            {
+                static const uint64_t cost = []()
+                {
+                    constexpr int READS = 1024;
+
+                    Clock::time_point start = Clock::now();
+                    Clock::time_point end   = start;
+
+                    for (int i = 0; i < READS; i++)
+                    {
+                        end = Clock::now();
+                    }
+
+                    return static_cast<uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(end -
+                                                                             start)
+                            .count() /
+                        READS);
+                }();
+
+                return cost;
+            }
+
+            /**
+             * @brief Charge the time since the last read to the innermost phase
+             *
+             * Every interval contains one read of the clock, which is not counted
+             **/
+            void Charge()
+            {
+                Clock::time_point now = Clock::now();
+
+                if (this->m_depth > 0)
+                {
+                    uint64_t elapsed =
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            now - this->m_mark)
+                            .count();
+
+                    this->m_sampledNs[this->m_open[this->m_depth - 1]] +=
+                        elapsed > this->m_clockCost ? elapsed - this->m_clockCost : 0;
+                }
+
+                this->m_mark = now;
+            }
+
+        public:
+            Timers()
+                : m_clockCost(ClockCost())
+            {
+                this->Reset();
+            }
+
+            /**
+             * @brief Clear the time and calls of every phase
+             **/
+            void Reset()
+            {
+                for (std::size_t i = 0; i < PHASES; i++)
+                {
+                    this->m_sampledNs[i] = 0;
+                    this->m_calls[i]     = 0;
+                }
+
+                this->m_iterations = 0;
+                this->m_sampled    = 0;
+                this->m_timing     = false;
+                this->m_depth      = 0;
+            }
+
+            /**
+             * @brief Start an iteration of the search loop, outside of any phase
+             **/
+            void Iteration()
+            {
+                this->m_timing = this->m_iterations++ % SAMPLE_PERIOD == 0;
+
+                if (this->m_timing)
+                    this->m_sampled++;
+            }
+
+            /**
+             * @brief Open a phase
+             * @param phase Phase to open
+             **/
+            void Start(Phase phase)
+            {
+                this->m_calls[phase]++;
+
+                if (this->m_timing)
+                    this->Charge();
+
+                if (this->m_depth < MAX_DEPTH)
+                    this->m_open[this->m_depth++] = phase;
+            }
+
+            /**
+             * @brief Close the innermost phase
+             **/
+            void Stop()
+            {
+                if (this->m_timing)
+                    this->Charge();
+
+                if (this->m_depth > 0)
+                    this->m_depth--;
+            }
+
+            /**
+             * @brief Get the breakdown of the search
+             * @return Calls and estimated time of each phase
+             **/
+            Breakdown Read() const
+            {
+                Breakdown breakdown;
+                breakdown.enabled    = true;
+                breakdown.iterations = this->m_iterations;
+                breakdown.sampled    = this->m_sampled;
+
+                for (std::size_t i = 0; i < PHASES; i++)
+                {
+                    breakdown.calls[i] = this->m_calls[i];
+                    breakdown.nanoseconds[i] =
+                        this->m_sampled == 0
+                            ? 0
+                            : this->m_sampledNs[i] * this->m_iterations /
+                                  this->m_sampled;
+                }
+
+                return breakdown;
+            }
+    };
+
+    /**
+     * @brief Keep a phase open for the lifetime of the scope, in the timers and in
+     * the allocation tracker
+     */
+    template<typename T>
+    class Scope
+    {
+        private:
+            T& m_timers; /**< Timers of the search */
+
+        public:
+            Scope(T& timers, Phase phase)
+                : m_timers(timers)
+            {
+                this->m_timers.Start(phase);
+                alloc::Enter(phase);
+            }
+
+            ~Scope()
+            {
+                alloc::Leave();
+                this->m_timers.Stop();
+            }
+
+            Scope(const Scope&)            = delete;
+            Scope& operator=(const Scope&) = delete;
+    };
+
+#ifdef SUDOKU_PHASE_TIMERS
+    using ActiveTimers = Timers<true>;
+#else
+    using ActiveTimers = Timers<false>;
+#endif
+} // namespace phase
+
+#endif // PHASE_TIMERS_H_
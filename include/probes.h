@@ -0,0 +1,66 @@
+/*
+ * Filename: probes.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef PROBES_H_
+#define PROBES_H_
+
+/**
+ * Static tracepoints (USDT) of the provider "sudoku", for bpftrace, perf and
+ * SystemTap. Each probe compiles to a single nop plus the moves of its arguments,
+ * and the tracer patches the nop only while it is attached. Each probe also has a
+ * semaphore, a counter that the tracer increments while it is attached, so
+ * SUDOKU_PROBE_ENABLED tells whether anyone listens to a probe. Without
+ * <sys/sdt.h> (systemtap-sdt-dev), or with SUDOKU_NO_PROBES defined, the probes
+ * compile to nothing and are never enabled. The probes are listed in readme.org
+ **/
+
+#if defined(__has_include) and not defined(SUDOKU_NO_PROBES)
+#if __has_include(<sys/sdt.h>)
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+#define SUDOKU_PROBES_ENABLED 1
+#endif
+#endif
+
+#ifdef SUDOKU_PROBES_ENABLED
+// The semaphores are defined in probes.cc, in the section where the tracers look
+// for them, under the name <sys/sdt.h> expects
+#define SUDOKU_SEMAPHORE(name) sudoku_##name##_semaphore
+#define SUDOKU_DECLARE_SEMAPHORE(name)                                                 \
+    __extension__ extern unsigned short SUDOKU_SEMAPHORE(name)                         \
+        __attribute__((unused)) __attribute__((section(".probes")))
+
+SUDOKU_DECLARE_SEMAPHORE(solve__start);
+SUDOKU_DECLARE_SEMAPHORE(solve__end);
+SUDOKU_DECLARE_SEMAPHORE(expand);
+SUDOKU_DECLARE_SEMAPHORE(push);
+SUDOKU_DECLARE_SEMAPHORE(pop);
+SUDOKU_DECLARE_SEMAPHORE(propagate);
+SUDOKU_DECLARE_SEMAPHORE(goal);
+SUDOKU_DECLARE_SEMAPHORE(subtree__start);
+SUDOKU_DECLARE_SEMAPHORE(subtree__end);
+
+#define SUDOKU_PROBE_ENABLED(name) __builtin_expect(SUDOKU_SEMAPHORE(name) != 0, 0)
+
+#define SUDOKU_PROBE1(name, a)          STAP_PROBE1(sudoku, name, a)
+#define SUDOKU_PROBE2(name, a, b)       STAP_PROBE2(sudoku, name, a, b)
+#define SUDOKU_PROBE3(name, a, b, c)    STAP_PROBE3(sudoku, name, a, b, c)
+#define SUDOKU_PROBE4(name, a, b, c, d) STAP_PROBE4(sudoku, name, a, b, c, d)
+#else
+#define SUDOKU_PROBE_ENABLED(name) false
+
+// The arguments are only named in sizeof, so they count as used but are never
+// evaluated
+#define SUDOKU_PROBE1(name, a) ((void)sizeof(a))
+#define SUDOKU_PROBE2(name, a, b) \
+    ((void)sizeof(a), (void)sizeof(b))
+#define SUDOKU_PROBE3(name, a, b, c) \
+    ((void)sizeof(a), (void)sizeof(b), (void)sizeof(c))
+#define SUDOKU_PROBE4(name, a, b, c, d) \
+    ((void)sizeof(a), (void)sizeof(b), (void)sizeof(c), (void)sizeof(d))
+#endif
+
+#endif // PROBES_H_
@@ -0,0 +1,107 @@
+/*
+ * Filename: progress.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef PROGRESS_H_
+#define PROGRESS_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief Namespace containing the live progress report of long solves
+ **/
+namespace progress
+{
+    /**
+     * @brief State of a search, published for the heartbeat
+     *
+     * The search stores its counters with relaxed stores, which are plain moves
+     * on x86, and the heartbeat only reads them. Fields a search does not have
+     * stay at zero and are not reported
+     */
+    struct Counters
+    {
+        std::atomic<uint64_t> expansions { 0 }; /**< Nodes expanded so far */
+        std::atomic<uint64_t> frontier { 0 };   /**< Nodes in the open list */
+        std::atomic<uint32_t> depth { 0 };      /**< Depth of the last expansion */
+        std::atomic<uint32_t> f { 0 };          /**< Priority of the last expansion */
+        std::atomic<uint32_t> limit { 0 };      /**< Depth limit of IDDFS */
+        std::atomic<uint64_t> done { 0 };       /**< Units of work finished */
+        std::atomic<uint64_t> total { 0 };      /**< Units of work, 0 if unknown */
+
+        /**
+         * @brief Set every counter to zero
+         **/
+        void Clear();
+    };
+
+    /**
+     * @brief Where and how often the heartbeat reports
+     */
+    struct Settings
+    {
+        uint64_t    periodNs   = 0;       /**< Time between reports, 0 for none */
+        const char* statusFile = nullptr; /**< Replaced at each report instead of
+                                             writing to the standard error */
+    };
+
+    /**
+     * @brief Parse the period of an option given as <n> seconds or <n>ms
+     * @param text Value of the option
+     * @param settings Receives the period
+     * @return True if the value is a positive period
+     **/
+    bool ParsePeriod(const char* text, Settings& settings);
+
+    /**
+     * @brief Thread that reports the counters of a search at a fixed period
+     *
+     * A report gives the elapsed time, the expansions and their rate over the
+     * last period, the frontier, the depth, f or depth limit when known, the
+     * resident memory of the process and, when the search knows its total work,
+     * an estimate of the time left
+     */
+    class Heartbeat
+    {
+        private:
+            const Counters&         m_counters; /**< Counters of the search */
+            Settings                m_settings; /**< Where and how often */
+            const char*             m_name;     /**< Algorithm of the search */
+            bool                    m_stop;     /**< Set by the destructor */
+            std::mutex              m_mutex;    /**< Guards m_stop */
+            std::condition_variable m_wake;     /**< Wakes the thread to stop */
+            std::thread             m_thread;   /**< Reporting thread */
+
+            /**
+             * @brief Report until the heartbeat is destroyed
+             **/
+            void Run();
+
+        public:
+            /**
+             * @brief Constructor. Starts the reporting thread
+             * @param counters Counters of the search, must outlive the heartbeat
+             * @param settings Where and how often to report
+             * @param name Algorithm of the search
+             */
+            Heartbeat(const Counters& counters,
+                      const Settings& settings,
+                      const char*     name);
+
+            /**
+             * @brief Destructor. Stops the reporting thread
+             **/
+            ~Heartbeat();
+
+            Heartbeat(const Heartbeat&)            = delete;
+            Heartbeat& operator=(const Heartbeat&) = delete;
+    };
+} // namespace progress
+
+#endif // PROGRESS_H_
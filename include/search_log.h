@@ -0,0 +1,292 @@
+/*
+ * Filename: search_log.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef SEARCH_LOG_H_
+#define SEARCH_LOG_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "board.h"
+#include "constants.h"
+
+/**
+ * @brief Namespace containing the binary log of the decisions of a tree search
+ *
+ * A log starts with a header (the puzzle, the algorithm and the options that
+ * change the search), followed by blocks of events. Each event is one byte, the
+ * kind in the high bits and a small value in the low bits, and children carry
+ * their step cost in a second byte. Blocks are compressed with a small LZ77
+ * coder by a writer thread, so the search only appends bytes to memory.
+ *
+ * Replaying a log runs the same search with the step costs read from the log
+ * instead of drawn from the random generator, and checks every decision against
+ * the recorded one
+ **/
+namespace searchlog
+{
+    constexpr std::size_t BLOCK_SIZE  = 1 << 16; /**< Event bytes per block */
+    constexpr std::size_t MAX_PENDING = 8;       /**< Blocks queued for the writer
+                                                    before the search waits */
+
+    /**
+     * @brief Kind of an event, in the three high bits of its first byte
+     */
+    enum Kind : uint8_t
+    {
+        EXPAND,   /**< A node is expanded. Then its cell, row * GRID_SIZE + col */
+        CHILD,    /**< A child is generated. Value: digit, then its step cost */
+        PRUNE,    /**< Propagation emptied a child. Value: digit */
+        DEAD_END, /**< The expanded node had no children */
+        CUTOFF,   /**< IDDFS dropped a node at the depth limit */
+        GOAL,     /**< A solution was found */
+        END,      /**< End of the search. Value: solved */
+        KINDS     /**< Number of kinds */
+    };
+
+    /**
+     * @brief What a replay needs to run the same search
+     */
+    struct Header
+    {
+        char        algorithm;                /**< Letter of the algorithm */
+        bool        propagate;                /**< Propagation was on */
+        uint64_t    seed;                     /**< Seed of the recorded run */
+        std::string variant;                  /**< As given to --variant */
+        uint8_t     cells[grid::BOARD_CELLS]; /**< Initial grid, 0 for empty */
+    };
+
+    /**
+     * @brief Get the name of an event kind
+     * @param kind Kind to name
+     * @return Name of the kind, in lowercase
+     **/
+    const char* KindName(Kind kind);
+
+    /**
+     * @brief Log of a search, recorded or replayed
+     */
+    class Log
+    {
+        private:
+            std::FILE* m_file;      /**< Log file, nullptr if it could not open */
+            bool       m_replaying; /**< Reading an existing log */
+            Header     m_header;    /**< Header of the log */
+
+            // Recording: bytes of the current block, blocks waiting for the writer
+            std::vector<uint8_t>              m_block;
+            std::deque<std::vector<uint8_t>>  m_pending;
+            std::mutex                        m_mutex;
+            std::condition_variable           m_ready;   /**< Wakes the writer */
+            std::condition_variable           m_drained; /**< Wakes the search */
+            bool                              m_closing; /**< No more blocks */
+            std::thread                       m_writer;
+
+            // Replay: bytes of the current block and the position in them
+            std::vector<uint8_t> m_events;
+            std::size_t          m_position;
+            uint64_t             m_read;       /**< Events checked so far */
+            bool                 m_diverged;   /**< A decision did not match */
+            std::string          m_divergence; /**< First mismatch */
+
+            /**
+             * @brief Compress and write queued blocks until the log closes
+             **/
+            void Write();
+
+            /**
+             * @brief Hand the current block to the writer thread
+             **/
+            void Submit();
+
+            /**
+             * @brief Append a byte to the current block
+             * @param byte Byte to append
+             **/
+            void Put(uint8_t byte)
+            {
+                this->m_block.push_back(byte);
+
+                if (this->m_block.size() >= BLOCK_SIZE)
+                    this->Submit();
+            }
+
+            /**
+             * @brief Read the next byte of the log, loading blocks as needed
+             * @param byte Receives the byte
+             * @return False at the end of the log
+             **/
+            bool Get(uint8_t& byte);
+
+            /**
+             * @brief Check the next event of a replay against the search
+             * @param kind Kind of the event of the search
+             * @param value Value of the event of the search
+             * @param second Second byte of the event of the search, or -1 to
+             * take the one of the log
+             * @return Second byte of the event in the log, 0 if it has none
+             **/
+            uint8_t Expect(Kind kind, uint8_t value, int second = -1);
+
+        public:
+            /**
+             * @brief Start recording a search
+             * @param path File of the log, replaced
+             * @param header Puzzle and options of the search
+             */
+            Log(const char* path, const Header& header);
+
+            /**
+             * @brief Open a log to replay it
+             * @param path File of the log
+             */
+            explicit Log(const char* path);
+
+            /**
+             * @brief Destructor. Writes the last block of a recording
+             **/
+            ~Log();
+
+            Log(const Log&)            = delete;
+            Log& operator=(const Log&) = delete;
+
+            /**
+             * @brief Check if the file could be opened and, for a replay, if its
+             * header is valid
+             * @return True if the log can be used
+             **/
+            bool IsOpen() const
+            {
+                return this->m_file != nullptr;
+            }
+
+            /**
+             * @brief Check if the log is being replayed
+             * @return True for a replay, false for a recording
+             **/
+            bool IsReplaying() const
+            {
+                return this->m_replaying;
+            }
+
+            /**
+             * @brief Get the header of the log
+             * @return Puzzle and options of the search
+             **/
+            const Header& GetHeader() const
+            {
+                return this->m_header;
+            }
+
+            /**
+             * @brief Record an event, or check it against the log
+             * @param kind Kind of the event
+             * @param value Value of the event, below 32
+             **/
+            void Event(Kind kind, uint8_t value = 0)
+            {
+                if (this->m_replaying)
+                    this->Expect(kind, value);
+                else
+                    this->Put(kind << 5 | value);
+            }
+
+            /**
+             * @brief Record the expansion of the cell at (row, col), or check it
+             * @param row Row of the cell
+             * @param col Column of the cell
+             **/
+            void Expand(uint16_t row, uint16_t col)
+            {
+                uint8_t cell = row * GRID_SIZE + col;
+
+                if (this->m_replaying)
+                {
+                    this->Expect(EXPAND, 0, cell);
+                }
+                else
+                {
+                    this->Put(EXPAND << 5);
+                    this->Put(cell);
+                }
+            }
+
+            /**
+             * @brief Record a child and its step cost
+             * @param digit Digit placed by the child
+             * @param cost Step cost drawn for the child
+             **/
+            void Child(uint16_t digit, uint16_t cost)
+            {
+                this->Put(CHILD << 5 | digit);
+                this->Put(cost);
+            }
+
+            /**
+             * @brief Check a child against a replayed log
+             * @param digit Digit placed by the child
+             * @return Step cost of the child in the log
+             **/
+            uint16_t ReplayChild(uint16_t digit)
+            {
+                return this->Expect(CHILD, digit);
+            }
+
+            /**
+             * @brief Get the number of events checked by a replay
+             * @return Number of events
+             **/
+            uint64_t EventsRead() const
+            {
+                return this->m_read;
+            }
+
+            /**
+             * @brief Check if a replay took a different decision than the log
+             * @return True if a decision did not match
+             **/
+            bool Diverged() const
+            {
+                return this->m_diverged;
+            }
+
+            /**
+             * @brief Describe the first decision that did not match
+             * @return Event number, expected and actual event
+             **/
+            const std::string& Divergence() const
+            {
+                return this->m_divergence;
+            }
+    };
+
+    /**
+     * @brief Compress a block with a byte-oriented LZ77
+     * @param input Bytes to compress
+     * @param output Receives the compressed bytes
+     **/
+    void Compress(const std::vector<uint8_t>& input, std::vector<uint8_t>& output);
+
+    /**
+     * @brief Restore a block compressed by Compress
+     * @param input Compressed bytes
+     * @param size Size of the original block
+     * @param output Receives the original bytes
+     * @return False if the input is corrupt
+     **/
+    bool Decompress(const std::vector<uint8_t>& input,
+                    std::size_t                 size,
+                    std::vector<uint8_t>&       output);
+} // namespace searchlog
+
+#endif // SEARCH_LOG_H_
@@ -0,0 +1,200 @@
+/*
+ * Filename: search_node.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef SEARCH_NODE_H_
+#define SEARCH_NODE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "board.h"
+#include "constants.h"
+#include "topology.h"
+
+namespace sudoku
+{
+    constexpr uint32_t    NO_PARENT  = UINT32_MAX; /**< Parent index of the root */
+    constexpr std::size_t CACHE_LINE = 64;         /**< Assumed cache line size */
+
+    /**
+     * @brief Node of the search tree
+     *
+     * Holds only the fields touched when a node is pushed to or popped from a
+     * frontier. The board itself lives in a parallel payload array, referenced by
+     * the state handle, so a node never straddles a cache line
+     */
+    struct alignas(32) SearchNode
+    {
+        uint16_t f;       /**< Priority used by the frontier */
+        uint16_t g;       /**< Cost from the root */
+        uint16_t h;       /**< Heuristic cost */
+        uint8_t  depth;   /**< Depth in the search tree */
+        uint8_t  row;     /**< Row changed by this node */
+        uint8_t  col;     /**< Column changed by this node */
+        uint8_t  num;     /**< Number placed by this node */
+        uint32_t parent;  /**< Index of the father node */
+        uint32_t payload; /**< Handle of the board in the payload array */
+    };
+
+    static_assert(sizeof(SearchNode) <= CACHE_LINE and
+                      CACHE_LINE % alignof(SearchNode) == 0,
+                  "SearchNode must fit in a single cache line");
+
+    /**
+     * @brief Storage of the search tree
+     *
+     * Nodes are append-only, so parent indices stay valid for the whole search.
+     * Payloads are recycled through a free list as soon as a node is released,
+     * which keeps the memory bounded by the frontier instead of by the tree
+     */
+    class NodeStore
+    {
+        private:
+            std::vector<SearchNode>  m_nodes;        /**< Node headers */
+            std::vector<grid::Board> m_payloads;     /**< Boards of the nodes */
+            std::vector<uint32_t>    m_freePayloads; /**< Payload slots to reuse */
+
+            /**
+             * @brief Get a free payload slot, growing the payload array if needed
+             * @return Handle of the payload slot
+             */
+            uint32_t AcquirePayload();
+
+        public:
+            NodeStore();
+
+            ~NodeStore();
+
+            /**
+             * @brief Remove all nodes and payloads
+             **/
+            void Clear();
+
+            /**
+             * @brief Create the root node of the search tree
+             * @param board Initial board
+             * @return Index of the root node
+             **/
+            uint32_t AddRoot(const grid::Board& board);
+
+            /**
+             * @brief Create a child node that places num at (row, col) over the
+             * board of its father
+             * @param father Index of the father node
+             * @param row Row of the change
+             * @param col Column of the change
+             * @param num Number placed
+             * @param topology Topology of the board
+             * @return Index of the child node
+             **/
+            uint32_t AddChild(uint32_t              father,
+                              uint16_t              row,
+                              uint16_t              col,
+                              uint16_t              num,
+                              const grid::Topology& topology);
+
+            /**
+             * @brief Release the payload of a node that will not be visited again
+             * @param id Index of the node
+             **/
+            void Release(uint32_t id);
+
+            /**
+             * @brief Get a node
+             * @param id Index of the node
+             * @return Reference to the node
+             **/
+            SearchNode& Node(uint32_t id)
+            {
+                return this->m_nodes[id];
+            }
+
+            /**
+             * @brief Get the board of a live node
+             * @param id Index of the node
+             * @return Reference to the board of the node
+             **/
+            grid::Board& Payload(uint32_t id)
+            {
+                return this->m_payloads[this->m_nodes[id].payload];
+            }
+
+            /**
+             * @brief Get the number of nodes created since the last Clear
+             * @return Number of nodes
+             **/
+            std::size_t Size() const
+            {
+                return this->m_nodes.size();
+            }
+
+            /**
+             * @brief Get the number of nodes whose payload was not released
+             * @return Number of live nodes
+             **/
+            std::size_t LiveNodes() const
+            {
+                return this->m_payloads.size() - this->m_freePayloads.size();
+            }
+
+            /**
+             * @brief Get the number of payload slots, live or free
+             * @return Size of the payload array
+             **/
+            std::size_t Payloads() const
+            {
+                return this->m_payloads.size();
+            }
+
+            /**
+             * @brief Get the number of payload slots waiting for reuse
+             * @return Size of the free list
+             **/
+            std::size_t FreePayloads() const
+            {
+                return this->m_freePayloads.size();
+            }
+
+            /**
+             * @brief Get the memory reserved by the node headers
+             * @return Capacity of the node array in bytes
+             **/
+            std::size_t NodeBytes() const
+            {
+                return this->m_nodes.capacity() * sizeof(SearchNode);
+            }
+
+            /**
+             * @brief Get the memory reserved by the boards
+             * @return Capacity of the payload array in bytes
+             **/
+            std::size_t PayloadBytes() const
+            {
+                return this->m_payloads.capacity() * sizeof(grid::Board);
+            }
+
+            /**
+             * @brief Get the memory reserved by the free list
+             * @return Capacity of the free list in bytes
+             **/
+            std::size_t FreeListBytes() const
+            {
+                return this->m_freePayloads.capacity() * sizeof(uint32_t);
+            }
+
+            /**
+             * @brief Get the memory reserved by the store, used or not
+             * @return Capacity of the node, payload and free list arrays in bytes
+             **/
+            std::size_t Bytes() const
+            {
+                return this->NodeBytes() + this->PayloadBytes() + this->FreeListBytes();
+            }
+    };
+} // namespace sudoku
+
+#endif // SEARCH_NODE_H_
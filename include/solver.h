@@ -7,54 +7,190 @@
 #ifndef SOLVER_H_
 #define SOLVER_H_
 
+#include <algorithm>
+#include <bit>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <functional>
+#include <iomanip>
 #include <iostream>
-#include <pthread.h>
+#include <optional>
+#include <queue>
 #include <random>
+#include <vector>
 
+#include "alloc_tracker.h"
+#include "annealing.h"
+#include "board.h"
 #include "constants.h"
-#include "graph.h"
-#include "graph_utils.h"
 #include "grid_utils.h"
-#include "priority_queue_bheap.h"
+#include "kernels.h"
+#include "memory_usage.h"
+#include "observer.h"
+#include "parallel_search.h"
+#include "perf_counters.h"
+#include "phase_timers.h"
+#include "progress.h"
 #include "queue_slkd.h"
+#include "search_log.h"
+#include "search_node.h"
 #include "stack_slkd.h"
-#include "vector.h"
-#include "vertex.h"
+#include "time_series.h"
+#include "topology.h"
+#include "trace.h"
+#include "tree_shape.h"
 
 namespace sudoku
 {
+    constexpr uint64_t EXPAND_BURST = 4096; /**< Expansions per traced span */
+
+    /**
+     * @brief Options that tune how the solver searches
+     */
+    struct SolverOptions
+    {
+        bool propagate = false; /**< Fill single-candidate cells after each move */
+
+        // Units of the puzzle. Must outlive the solver
+        const grid::Topology* topology = &grid::CLASSIC;
+
+        std::size_t iterations = 2000000; /**< Move budget of the local search */
+
+        std::size_t threads       = 1;     /**< Workers of the parallel search */
+        bool        deterministic = false; /**< Parallel results independent of
+                                              timing and thread count */
+
+        // Seed of the step costs and of the local search. 0 picks one from the
+        // clock
+        uint64_t seed = 0;
+
+        bool perfCounters = false; /**< Count the events of perf::CounterGroup */
+
+        series::Interval series;               /**< Sampling of the tree searches */
+        const char*      seriesFile = nullptr; /**< Dump of the samples by Solve */
+
+        progress::Settings heartbeat; /**< Live report of the search */
+
+        const char*     record = nullptr; /**< Log of the decisions to write */
+        searchlog::Log* replay = nullptr; /**< Log to replay, overrides record */
+
+        bool histograms = false; /**< Collect the shape of the search tree */
+        bool memory     = false; /**< Account the peak memory of each structure */
+    };
+
+    /**
+     * @brief Outcome of a search run without printing
+     */
+    struct SolveResult
+    {
+        bool        valid;             /**< The initial grid repeats no number */
+        bool        solved;            /**< A solution was found */
+        grid::Board solution;          /**< Solved board, only set when solved */
+        uint64_t    nanoseconds;       /**< Wall time of the search */
+        std::size_t expandedStates;    /**< Number of expanded states */
+        std::size_t expansions;        /**< Number of nodes expanded */
+        std::size_t moves;             /**< Moves tried by the local search */
+        std::size_t propagated;        /**< Cells filled by propagation */
+
+        ParallelStats parallel; /**< Work distribution, only set by the parallel
+                                   search */
+
+        phase::Breakdown phases; /**< Time per phase, only set by the tree searches
+                                    built with SUDOKU_PHASE_TIMERS */
+
+        perf::Sample counters; /**< Hardware events of the calling thread, only set
+                                  with SolverOptions::perfCounters */
+
+        alloc::Stats allocations; /**< Heap allocations of the calling thread, only
+                                     set when built with SUDOKU_ALLOC_TRACKER */
+
+        std::vector<series::Sample> series; /**< Growth of the tree searches,
+                                               only set with SolverOptions::series */
+        series::Peaks               peaks;  /**< Highest values of the samples */
+
+        shape::Histograms shape; /**< Nodes, branching and dead ends per depth, only
+                                    set with SolverOptions::histograms */
+
+        memory::Usage memory; /**< Peak bytes of each structure, only set with
+                                 SolverOptions::memory */
+    };
+
+    /**
+     * @brief Get the name of an algorithm, as printed after a search
+     * @param algorithm Algorithm to name
+     * @return Name of the algorithm
+     **/
+    const char* AlgorithmName(Algorithm algorithm);
+
     /**
      * @brief Class that represents the solver of the sudoku puzzle
      */
     class Solver
     {
         private:
-            uint16_t  m_startGrid[GRID_SIZE][GRID_SIZE]; /**< Initial grid */
-            Algorithm m_algorithm; /**< Algorithm to solve the puzzle */
+            uint16_t      m_startGrid[GRID_SIZE][GRID_SIZE]; /**< Initial grid */
+            grid::Board   m_startBoard; /**< Initial grid as a board */
+            Algorithm     m_algorithm;  /**< Algorithm to solve the puzzle */
+            SolverOptions m_options;    /**< Options of the search */
+
+            uint32_t    m_solutionNode;   /**< Index of the node that represents the
+                                             solution */
+            std::size_t m_expandedStates; /**< Number of expanded states */
+            std::size_t m_expansions;     /**< Number of nodes expanded */
+            std::size_t m_moves;          /**< Moves tried by the local search */
+            std::size_t m_propagated;     /**< Cells filled by propagation */
+            std::size_t m_frontier;       /**< Nodes in the open list */
+
+            // Search tree. Each node keeps only what the frontiers touch, while the
+            // boards live in a parallel payload array
+            NodeStore m_nodes;
+
+            // Children generated by the last call to ExpandNode. Kept as a member so
+            // the buffer is reused across expansions
+            std::vector<uint32_t> m_children;
+
+            // Conflicts sampled by the local search
+            std::vector<annealing::Sample> m_trajectory;
+
+            // Time per phase of the tree searches. Empty unless the project is
+            // configured with SUDOKU_PHASE_TIMERS
+            phase::ActiveTimers m_phases;
+
+            // Growth of the open list and of the node store over the search
+            series::Recorder m_series;
+
+            // Expansions of the tree searches, traced in bursts of EXPAND_BURST
+            trace::Burst m_burst;
+
+            // State of the search, read by the heartbeat thread
+            progress::Counters m_progress;
+
+            // Log of the decisions being recorded or replayed, only set during Run
+            searchlog::Log* m_log;
 
-            std::size_t m_vertexSolutionID; /**< ID of the vertex that represents the
-                                               solution */
-            std::size_t m_expandedStates;   /**< Number of expanded states */
+            // Shape of the search tree, with SolverOptions::histograms
+            shape::Histograms m_shape;
 
-            // Each vertex stores a vector of pairs with the index of the row and column
-            // of the grid and the change made at that position
-            graph::Graph<uint16_t, uint16_t, Vector<State>, 2, true>
-                m_graph; /**< Graph that
-                  represents the
-                  search tree */
+            ParallelStats m_parallelStats; /**< Work distribution of the parallel
+                                              search */
+
+            // Source of the step costs. Seeded once, so a given seed always gives
+            // the same costs
+            std::mt19937_64 m_random;
 
             /**
-             * @brief Get the state of the vertex
-             * @param vertex Vertex to get the state
-             * @param grid Grid to store the state of the vertex
-             */
-            void
-            GetVertexState(graph::Vertex<uint16_t, uint16_t, Vector<State>>& vertex,
-                           uint16_t grid[GRID_SIZE][GRID_SIZE]);
+             * @brief Key used by the priority frontiers
+             *
+             * The priority of the node goes in the high bits and its index in the
+             * low bits, so the heap compares plain integers and ties are broken in
+             * generation order
+             *
+             * @param id Index of the node
+             * @return Key of the node
+             **/
+            uint64_t PriorityKey(uint32_t id);
 
             /**
              * @brief Generate a random cost for the vertex
@@ -64,98 +200,227 @@ namespace sudoku
             uint16_t GenRandomCost();
 
             /**
-             * @brief Calculate the heuristic of the vertex for the A* algorithm
+             * @brief Get the step cost of a child
+             *
+             * Drawn from the generator, except when a log is replayed. A recording
+             * keeps the cost in the log
+             *
+             * @param num Number placed by the child
+             * @return Step cost
+             **/
+            uint16_t StepCost(uint16_t num);
+
+            /**
+             * @brief Describe the search for the header of a log
+             * @return Puzzle, algorithm and options of the search
+             **/
+            searchlog::Header LogHeader();
+
+            /**
+             * @brief Calculate the heuristic of the node for the A* algorithm
              *
              * The heuristic is the amount of possible values in the cell modified by
-             * the vertex state
+             * the node
              *
-             * @param vertex Vertex to calculate the heuristic
-             * @return Heuristic of the vertex
+             * @param id Index of the node to calculate the heuristic
+             * @return Heuristic of the node
              */
-            uint16_t CalculateAStarHeuristic(
-                graph::Vertex<uint16_t, uint16_t, Vector<State>>& vertex);
+            uint16_t CalculateAStarHeuristic(uint32_t id);
 
             /**
-             * @brief Calculate the heuristic of the vertex for the Greedy Best-First
+             * @brief Calculate the heuristic of the node for the Greedy Best-First
              * Search algorithm
              *
              * The heuristic is the amount of empty cells in the grid
              *
-             * @param vertex Vertex to calculate the heuristic
-             * @return Heuristic of the vertex
+             * @param id Index of the node to calculate the heuristic
+             * @return Heuristic of the node
              */
-            uint16_t CalculateGreedyBFSHeuristic(
-                graph::Vertex<uint16_t, uint16_t, Vector<State>>& vertex);
+            uint16_t CalculateGreedyBFSHeuristic(uint32_t id);
 
             /**
              * @brief Create the initial state of the puzzle
+             * @param observer Observer of the search
+             * @return Index of the root node, or NO_PARENT if propagation proved
+             * that the puzzle has no solution
              **/
-            void CreateInitialState();
+            template<typename Observer>
+            uint32_t CreateInitialState(Observer& observer);
 
             /**
-             * @brief Check if the state of the vertex is a solution
-             * @param vertex Vertex to check if it is a solution
-             * @return True if the vertex is a solution, false otherwise
+             * @brief Check if the state of the node is a solution
+             * @param id Index of the node to check if it is a solution
+             * @param observer Observer of the search
+             * @return True if the node is a solution, false otherwise
              **/
-            bool
-            CheckSolution(graph::Vertex<uint16_t, uint16_t, Vector<State>>& vertex);
+            template<typename Observer>
+            bool CheckSolution(uint32_t id, Observer& observer);
 
             /**
              * @brief Expands the node in the search tree by choosing an empty cell and
              * creating child nodes for all valid values for that cell
-             * @param fatherVertex Father of the node to expand
+             *
+             * The indices of the children are stored in m_children. When
+             * propagation is enabled, children that run out of candidates are
+             * discarded
+             *
+             * @param father Index of the node to expand
+             * @param observer Observer of the search
              */
-            void
-            ExpandNode(graph::Vertex<uint16_t, uint16_t, Vector<State>>& fatherVertex);
+            template<typename Observer>
+            void ExpandNode(uint32_t father, Observer& observer);
 
             /**
-             * @brief Print the state of the vertex
-             * @param vertex Vertex to print the state
+             * @brief Count a node pushed to the open list
+             * @param id Index of the node
+             * @param observer Observer of the search
+             **/
+            template<typename Observer>
+            void Pushed(uint32_t id, Observer& observer);
+
+            /**
+             * @brief Count a node popped from the open list
+             * @param id Index of the node
+             * @param observer Observer of the search
+             **/
+            template<typename Observer>
+            void Popped(uint32_t id, Observer& observer);
+
+            /**
+             * @brief Release the board of a node that will not be visited again
+             * @param id Index of the node
+             **/
+            void ReleaseNode(uint32_t id);
+
+            /**
+             * @brief Print the state of the node
+             * @param id Index of the node to print the state
              * @param pythonStyle If true, print the state in a Python style
              **/
-            void PrintState(graph::Vertex<uint16_t, uint16_t, Vector<State>>& vertex,
-                            bool pythonStyle = false);
+            void PrintState(uint32_t id, bool pythonStyle = false);
+
+            /**
+             * @brief Print the time spent in each phase of the search
+             * @param result Outcome of the search, with the phases
+             **/
+            void PrintPhases(const SolveResult& result);
+
+            /**
+             * @brief Print the heap allocations of the search, in total and per
+             * phase
+             * @param result Outcome of the search, with the allocations
+             **/
+            void PrintAllocations(const SolveResult& result);
+
+            /**
+             * @brief Print the high water marks of the search, and dump its samples
+             * to SolverOptions::seriesFile when one was given
+             * @param result Outcome of the search, with the samples
+             **/
+            void PrintSeries(const SolveResult& result);
+
+            /**
+             * @brief Print the histograms of the shape of the search tree
+             * @param result Outcome of the search, with the histograms
+             **/
+            void PrintShape(const SolveResult& result);
+
+            /**
+             * @brief Print the memory of each structure of the search
+             * @param result Outcome of the search, with the accounting
+             **/
+            void PrintMemory(const SolveResult& result);
+
+            /**
+             * @brief Fill the accounting of a search with the reserved bytes, the
+             * open list and the resident memory
+             * @param usage Receives the bytes, with the peaks of the node store and
+             * the largest frontier already set by the observer
+             **/
+            void AccountMemory(memory::Usage& usage);
 
             /**
              * @brief Solve the puzzle using the Breadth-First Search algorithm
+             * @param observer Observer of the search
              * @return True if the puzzle was solved, false otherwise
              **/
-            bool BFS();
+            template<typename Observer>
+            bool BFS(Observer& observer);
 
             /**
              * @brief Solve the puzzle using the Iterative Deepening Depth-First Search
              * algorithm
+             * @param observer Observer of the search
              * @param maxDepth Maximum depth of the search. By default, it is set to
              * infinity
              * @return True if the puzzle was solved, false otherwise
              **/
-            bool IDDFS(std::size_t maxDepth = GRID_SIZE * GRID_SIZE);
+            template<typename Observer>
+            bool IDDFS(Observer&   observer,
+                       std::size_t maxDepth = GRID_SIZE * GRID_SIZE);
 
             /**
              * @brief Solve the puzzle using the Uniform Cost Search algorithm
+             * @param observer Observer of the search
              * @return True if the puzzle was solved, false otherwise
              **/
-            bool UCS();
+            template<typename Observer>
+            bool UCS(Observer& observer);
 
             /**
              * @brief Solve the puzzle using the A* algorithm
+             * @param observer Observer of the search
              * @return True if the puzzle was solved, false otherwise
              **/
-            bool AStar();
+            template<typename Observer>
+            bool AStar(Observer& observer);
 
             /**
              * @brief Solve the puzzle using the Greedy Best-First Search algorithm
+             * @param observer Observer of the search
+             * @return True if the puzzle was solved, false otherwise
+             **/
+            template<typename Observer>
+            bool GreedyBFS(Observer& observer);
+
+            /**
+             * @brief Solve the puzzle by simulated annealing over complete
+             * assignments
+             *
+             * Not exhaustive: a false result only means the move budget ran out
+             *
+             * @param observer Observer of the search
+             * @return True if the puzzle was solved, false otherwise
+             **/
+            template<typename Observer>
+            bool Annealing(Observer& observer);
+
+            /**
+             * @brief Solve the puzzle using the parallel Depth-First Search
+             * @param observer Observer of the search
+             * @return True if the puzzle was solved, false otherwise
+             **/
+            template<typename Observer>
+            bool ParallelSearch(Observer& observer);
+
+            /**
+             * @brief Solve the puzzle with the algorithm of the solver
+             * @param observer Observer of the search, compiled into the loops
              * @return True if the puzzle was solved, false otherwise
              **/
-            bool GreedyBFS();
+            template<typename Observer>
+            bool Search(Observer& observer);
 
         public:
             /**
              * @brief Constructor
              * @param startGrid Initial grid
              * @param algorithm Algorithm to solve the puzzle
+             * @param options Options of the search
              */
-            Solver(uint16_t startGrid[GRID_SIZE][GRID_SIZE], Algorithm algorithm);
+            Solver(uint16_t             startGrid[GRID_SIZE][GRID_SIZE],
+                   Algorithm            algorithm,
+                   const SolverOptions& options = SolverOptions());
 
             ~Solver();
 
@@ -165,9 +430,22 @@ namespace sudoku
             void PrintAlgorithm();
 
             /**
-             * @brief Solve the puzzle
+             * @brief Solve the puzzle without printing anything
+             *
+             * Each call starts from the initial grid, so a solver can be run
+             * several times. Runs of the randomized algorithms continue the
+             * sequence of the seed
+             *
+             * @return Outcome and counters of the search
+             **/
+            SolveResult Run();
+
+            /**
+             * @brief Solve the puzzle and print the outcome
+             * @return Outcome and counters of the search. Not valid if the grid
+             * repeats a number, solved without a search if it is already complete
              **/
-            void Solve();
+            SolveResult Solve();
     };
 } // namespace sudoku
 
@@ -0,0 +1,189 @@
+/*
+ * Filename: time_series.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef TIME_SERIES_H_
+#define TIME_SERIES_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Namespace containing the sampling of the growth of a search
+ **/
+namespace series
+{
+    constexpr std::size_t CAPACITY     = 4096; /**< Samples kept by the ring buffer */
+    constexpr uint64_t    CLOCK_STRIDE = 256;  /**< Expansions between reads of the
+                                                  clock when sampling by time */
+
+    /**
+     * @brief State of the search at one point of a solve
+     */
+    struct Sample
+    {
+        uint64_t nanoseconds; /**< Time since the start of the search */
+        uint64_t expansions;  /**< Nodes expanded so far */
+        uint64_t frontier;    /**< Nodes in the open list */
+        uint64_t liveNodes;   /**< Nodes whose board was not released */
+        uint64_t arenaBytes;  /**< Bytes reserved by the node store */
+        double   rate;        /**< Expansions per second since the previous sample */
+    };
+
+    /**
+     * @brief Highest values seen by the samples of a solve
+     */
+    struct Peaks
+    {
+        uint64_t frontier;   /**< Largest open list */
+        uint64_t liveNodes;  /**< Most live nodes */
+        uint64_t arenaBytes; /**< Largest node store */
+    };
+
+    /**
+     * @brief When to take a sample
+     *
+     * With both fields zero the recorder is off, and a search only pays one
+     * comparison per expansion
+     */
+    struct Interval
+    {
+        uint64_t expansions = 0; /**< Sample every this many expansions */
+        uint64_t periodNs   = 0; /**< Or every this many nanoseconds */
+    };
+
+    /**
+     * @brief Samples of a solve, kept in a ring buffer
+     *
+     * Due is the only call on the hot path: it compares the expansions against
+     * the next sampling point. When the buffer is full the oldest samples are
+     * overwritten, but the peaks still cover the whole solve
+     */
+    class Recorder
+    {
+        private:
+            using Clock = std::chrono::steady_clock;
+
+            Interval            m_interval; /**< When to take a sample */
+            uint64_t            m_next;     /**< Expansions of the next check */
+            std::vector<Sample> m_samples;  /**< Ring buffer */
+            std::size_t         m_head;     /**< Slot of the next sample */
+            std::size_t         m_count;    /**< Samples in the buffer */
+            uint64_t            m_taken;    /**< Samples taken, kept or not */
+            Peaks               m_peaks;    /**< Highest values sampled */
+            Sample              m_last;     /**< Last sample taken */
+            Clock::time_point   m_start;    /**< Start of the search */
+
+        public:
+            /**
+             * @brief Constructor
+             * @param interval When to take a sample, off by default
+             */
+            explicit Recorder(const Interval& interval = Interval());
+
+            ~Recorder();
+
+            /**
+             * @brief Check if the recorder takes samples
+             * @return True if an interval was given
+             **/
+            bool IsEnabled() const
+            {
+                return this->m_interval.expansions > 0 or this->m_interval.periodNs > 0;
+            }
+
+            /**
+             * @brief Forget the samples and start the clock of a new search
+             **/
+            void Start();
+
+            /**
+             * @brief Check if a sample may be due
+             * @param expansions Nodes expanded so far
+             * @return True if Record should be called
+             **/
+            bool Due(uint64_t expansions) const
+            {
+                return expansions >= this->m_next;
+            }
+
+            /**
+             * @brief Take a sample, if its interval has passed
+             * @param expansions Nodes expanded so far
+             * @param frontier Nodes in the open list
+             * @param liveNodes Nodes whose board was not released
+             * @param arenaBytes Bytes reserved by the node store
+             **/
+            void Record(uint64_t expansions,
+                        uint64_t frontier,
+                        uint64_t liveNodes,
+                        uint64_t arenaBytes);
+
+            /**
+             * @brief Take the last sample of a search, whatever the interval
+             * @param expansions Nodes expanded so far
+             * @param frontier Nodes in the open list
+             * @param liveNodes Nodes whose board was not released
+             * @param arenaBytes Bytes reserved by the node store
+             **/
+            void Finish(uint64_t expansions,
+                        uint64_t frontier,
+                        uint64_t liveNodes,
+                        uint64_t arenaBytes);
+
+            /**
+             * @brief Get the samples in the buffer
+             * @return Samples, oldest first
+             **/
+            std::vector<Sample> Samples() const;
+
+            /**
+             * @brief Get the highest values sampled
+             * @return Peaks of the search
+             **/
+            const Peaks& HighWater() const
+            {
+                return this->m_peaks;
+            }
+
+            /**
+             * @brief Get the number of samples taken, including the overwritten ones
+             * @return Number of samples
+             **/
+            uint64_t Taken() const
+            {
+                return this->m_taken;
+            }
+    };
+
+    /**
+     * @brief Parse the interval of an option given as <n> or <n>ms
+     * @param text Value of the option
+     * @param interval Receives the interval
+     * @return True if the value is a positive number of expansions or
+     * milliseconds
+     **/
+    bool ParseInterval(const char* text, Interval& interval);
+
+    /**
+     * @brief Append the samples of a solve to a file
+     *
+     * The first dump of the process truncates the file, so the solves of a batch
+     * end up together, numbered in the order they were dumped. The format follows
+     * the extension: .json for JSON Lines, CSV otherwise
+     *
+     * @param path File to write
+     * @param algorithm Name of the algorithm of the solve
+     * @param samples Samples of the solve, oldest first
+     * @return False if the file cannot be written
+     **/
+    bool Dump(const char*                path,
+              const char*                algorithm,
+              const std::vector<Sample>& samples);
+} // namespace series
+
+#endif // TIME_SERIES_H_
@@ -0,0 +1,236 @@
+/*
+ * Filename: topology.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef TOPOLOGY_H_
+#define TOPOLOGY_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "constants.h"
+
+namespace grid
+{
+    constexpr std::size_t BOARD_CELLS     = GRID_SIZE * GRID_SIZE;
+    constexpr std::size_t MAX_EXTRA_UNITS = 4;  /**< Diagonals or windows */
+    constexpr std::size_t MAX_UNITS       = 3 * GRID_SIZE + MAX_EXTRA_UNITS;
+    constexpr std::size_t MAX_PEERS       = 32; /**< Peers of the center of X-Sudoku */
+    constexpr std::size_t MAX_CELL_UNITS  = 3 + MAX_EXTRA_UNITS;
+
+    // Units are numbered rows first, then columns, then regions, then extra units
+    constexpr std::size_t ROW_UNITS    = 0;
+    constexpr std::size_t COL_UNITS    = GRID_SIZE;
+    constexpr std::size_t REGION_UNITS = 2 * GRID_SIZE;
+    constexpr std::size_t EXTRA_UNITS  = 3 * GRID_SIZE;
+
+    /**
+     * @brief Variants with a fixed unit structure
+     */
+    enum class Variant : uint8_t
+    {
+        CLASSIC,  /**< Rows, columns and boxes */
+        DIAGONAL, /**< Classic plus both main diagonals (X-Sudoku) */
+        WINDOKU,  /**< Classic plus the windows between the boxes */
+    };
+
+    /**
+     * @brief Unit and peer tables of a sudoku variant
+     *
+     * Every variant has rows and columns, and splits the grid into GRID_SIZE
+     * regions (the boxes, or the pieces of a jigsaw). Extra units such as diagonals
+     * are listed separately, so the classic board pays nothing for them
+     */
+    struct Topology
+    {
+        const char* name;                /**< Name of the variant */
+        uint8_t     region[BOARD_CELLS]; /**< Region of each cell */
+        uint8_t     extraCount;          /**< Number of extra units */
+
+        // Cells of each extra unit
+        uint8_t extra[MAX_EXTRA_UNITS][GRID_SIZE];
+
+        // Bit k is set when the cell belongs to the extra unit k
+        uint8_t extraMask[BOARD_CELLS];
+
+        // Cells that share at least one unit with each cell
+        uint8_t peerCount[BOARD_CELLS];
+        uint8_t peers[BOARD_CELLS][MAX_PEERS];
+
+        /**
+         * @brief Get the number of units of the variant
+         * @return Number of units
+         **/
+        constexpr std::size_t Units() const
+        {
+            return EXTRA_UNITS + this->extraCount;
+        }
+    };
+
+    /**
+     * @brief List the units that contain a cell
+     * @param topology Topology of the grid
+     * @param cell Cell in row-major order
+     * @param units Receives the units of the cell
+     * @return Number of units of the cell
+     **/
+    constexpr std::size_t
+    CellUnits(const Topology& topology, std::size_t cell, uint8_t units[MAX_CELL_UNITS])
+    {
+        std::size_t count = 0;
+
+        units[count++] = ROW_UNITS + cell / GRID_SIZE;
+        units[count++] = COL_UNITS + cell % GRID_SIZE;
+        units[count++] = REGION_UNITS + topology.region[cell];
+
+        for (std::size_t unit = 0; unit < topology.extraCount; unit++)
+        {
+            if (topology.extraMask[cell] & (1 << unit))
+                units[count++] = EXTRA_UNITS + unit;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Check if two cells share a unit
+     * @param topology Topology of the grid
+     * @param a First cell
+     * @param b Second cell
+     * @return True if the cells share a unit, false otherwise
+     **/
+    constexpr bool SharesUnit(const Topology& topology, std::size_t a, std::size_t b)
+    {
+        return a / GRID_SIZE == b / GRID_SIZE or a % GRID_SIZE == b % GRID_SIZE or
+               topology.region[a] == topology.region[b] or
+               (topology.extraMask[a] & topology.extraMask[b]) != 0;
+    }
+
+    /**
+     * @brief Derive the extra masks and peers from the regions and extra units
+     * @param topology Topology to complete
+     **/
+    constexpr void FinishTopology(Topology& topology)
+    {
+        for (std::size_t cell = 0; cell < BOARD_CELLS; cell++)
+        {
+            topology.extraMask[cell] = 0;
+        }
+
+        for (std::size_t unit = 0; unit < topology.extraCount; unit++)
+        {
+            for (std::size_t i = 0; i < GRID_SIZE; i++)
+            {
+                topology.extraMask[topology.extra[unit][i]] |= 1 << unit;
+            }
+        }
+
+        for (std::size_t cell = 0; cell < BOARD_CELLS; cell++)
+        {
+            topology.peerCount[cell] = 0;
+
+            for (std::size_t other = 0; other < BOARD_CELLS; other++)
+            {
+                if (other != cell and SharesUnit(topology, cell, other))
+                    topology.peers[cell][topology.peerCount[cell]++] = other;
+            }
+        }
+    }
+
+    /**
+     * @brief Build the topology of a variant with a fixed unit structure
+     * @param variant Variant to build
+     * @return Topology of the variant
+     **/
+    constexpr Topology MakeTopology(Variant variant)
+    {
+        Topology topology = { };
+
+        for (std::size_t cell = 0; cell < BOARD_CELLS; cell++)
+        {
+            std::size_t row = cell / GRID_SIZE;
+            std::size_t col = cell % GRID_SIZE;
+
+            topology.region[cell] =
+                (row / SUBGRID_SIZE) * SUBGRID_SIZE + col / SUBGRID_SIZE;
+        }
+
+        switch (variant)
+        {
+            case Variant::CLASSIC:
+                topology.name = "classic";
+                break;
+
+            case Variant::DIAGONAL:
+                topology.name       = "diagonal";
+                topology.extraCount = 2;
+
+                for (std::size_t i = 0; i < GRID_SIZE; i++)
+                {
+                    topology.extra[0][i] = i * GRID_SIZE + i;
+                    topology.extra[1][i] = i * GRID_SIZE + (GRID_SIZE - 1 - i);
+                }
+                break;
+
+            case Variant::WINDOKU:
+                topology.name = "windoku";
+
+                // One window in each gap between the boxes, shifted one cell down
+                // and right from a box
+                for (std::size_t top = 1; top + SUBGRID_SIZE < GRID_SIZE;
+                     top += SUBGRID_SIZE + 1)
+                {
+                    for (std::size_t left = 1; left + SUBGRID_SIZE < GRID_SIZE;
+                         left += SUBGRID_SIZE + 1)
+                    {
+                        for (std::size_t i = 0; i < GRID_SIZE; i++)
+                        {
+                            topology.extra[topology.extraCount][i] =
+                                (top + i / SUBGRID_SIZE) * GRID_SIZE + left +
+                                i % SUBGRID_SIZE;
+                        }
+
+                        topology.extraCount++;
+                    }
+                }
+                break;
+        }
+
+        FinishTopology(topology);
+
+        return topology;
+    }
+
+    // Tables of the standard variants, generated at compile time
+    inline constexpr Topology CLASSIC  = MakeTopology(Variant::CLASSIC);
+    inline constexpr Topology DIAGONAL = MakeTopology(Variant::DIAGONAL);
+    inline constexpr Topology WINDOKU  = MakeTopology(Variant::WINDOKU);
+
+    static_assert(CLASSIC.peerCount[0] == 20, "Classic cells have 20 peers");
+    static_assert(WINDOKU.extraCount == MAX_EXTRA_UNITS, "Windoku has 4 windows");
+
+    /**
+     * @brief Build the topology of a jigsaw sudoku
+     * @param regions GRID_SIZE * GRID_SIZE characters in row-major order, each one
+     * the region ('1' to GRID_SIZE) of the cell
+     * @param topology Receives the topology
+     * @return True if every region has exactly GRID_SIZE cells, false otherwise
+     **/
+    bool MakeJigsaw(const char* regions, Topology& topology);
+
+    /**
+     * @brief Find the topology of a variant by name
+     *
+     * Accepts classic, diagonal, windoku, or jigsaw:<regions> (see MakeJigsaw).
+     * Jigsaw tables are stored in custom
+     *
+     * @param name Name of the variant
+     * @param custom Storage for topologies built at load time
+     * @return Topology of the variant, or nullptr if the name is invalid
+     **/
+    const Topology* FindTopology(const char* name, Topology& custom);
+} // namespace grid
+
+#endif // TOPOLOGY_H_
@@ -0,0 +1,217 @@
+/*
+ * Filename: trace.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Namespace containing the recording of solver activity as a Chrome trace
+ *
+ * While a Session is open, spans and instants are appended to a buffer owned by
+ * the thread that records them, so threads never share a lock on the hot path.
+ * The buffers are written as Chrome trace-event JSON when the session closes,
+ * which chrome://tracing and ui.perfetto.dev both open. Without a session every
+ * call costs one relaxed load
+ **/
+namespace trace
+{
+    constexpr std::size_t MAX_EVENTS = 1 << 20; /**< Events kept per thread, later
+                                                   ones are counted as dropped */
+
+    /**
+     * @brief Whether a session is open. Use IsEnabled
+     */
+    extern std::atomic<bool> g_enabled;
+
+    /**
+     * @brief Check if events are being recorded
+     * @return True while a session is open
+     **/
+    inline bool IsEnabled()
+    {
+        return g_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the time of the trace clock
+     * @return Nanoseconds since the start of the session
+     **/
+    uint64_t Now();
+
+    /**
+     * @brief Record a span of the calling thread
+     * @param name Name of the span. Must be a string literal or outlive the session
+     * @param category Category of the span, with the same lifetime as name
+     * @param start Start of the span, from Now
+     * @param argument Name of the argument of the span, or nullptr for none
+     * @param value Value of the argument
+     **/
+    void Complete(const char* name,
+                  const char* category,
+                  uint64_t    start,
+                  const char* argument = nullptr,
+                  uint64_t    value    = 0);
+
+    /**
+     * @brief Record an instant event of the calling thread
+     * @param name Name of the event, with the same lifetime as in Complete
+     * @param category Category of the event
+     * @param argument Name of the argument of the event, or nullptr for none
+     * @param value Value of the argument
+     **/
+    void Instant(const char* name,
+                 const char* category,
+                 const char* argument = nullptr,
+                 uint64_t    value    = 0);
+
+    /**
+     * @brief Name the calling thread in the trace
+     * @param name Prefix of the name, with the same lifetime as in Complete
+     * @param index Number appended to the prefix
+     **/
+    void NameThread(const char* name, std::size_t index);
+
+    /**
+     * @brief Record the lifetime of a scope as a span
+     */
+    class Span
+    {
+        private:
+            const char* m_name;     /**< Name of the span */
+            const char* m_category; /**< Category of the span */
+            const char* m_argument; /**< Name of the argument, or nullptr */
+            uint64_t    m_value;    /**< Value of the argument */
+            uint64_t    m_start;    /**< Start of the span */
+            bool        m_open;     /**< A session was open at the start */
+
+        public:
+            Span(const char* name, const char* category)
+                : m_name(name),
+                  m_category(category),
+                  m_argument(nullptr),
+                  m_value(0),
+                  m_start(0),
+                  m_open(IsEnabled())
+            {
+                if (this->m_open)
+                    this->m_start = Now();
+            }
+
+            ~Span()
+            {
+                if (this->m_open)
+                    Complete(this->m_name,
+                             this->m_category,
+                             this->m_start,
+                             this->m_argument,
+                             this->m_value);
+            }
+
+            Span(const Span&)            = delete;
+            Span& operator=(const Span&) = delete;
+
+            /**
+             * @brief Attach an argument to the span
+             * @param argument Name of the argument, with the same lifetime as the
+             * name of the span
+             * @param value Value of the argument
+             **/
+            void Argument(const char* argument, uint64_t value)
+            {
+                this->m_argument = argument;
+                this->m_value    = value;
+            }
+    };
+
+    /**
+     * @brief Record runs of a hot operation as spans of a fixed number of calls
+     *
+     * Tracing every expansion would flood the buffers, so the expansions are
+     * grouped in bursts: a span is recorded every size ticks, with the number of
+     * ticks as its argument
+     */
+    class Burst
+    {
+        private:
+            const char* m_name;     /**< Name of the spans */
+            const char* m_category; /**< Category of the spans */
+            uint64_t    m_size;     /**< Ticks per span */
+            uint64_t    m_ticks;    /**< Ticks of the open span */
+            uint64_t    m_start;    /**< Start of the open span */
+
+        public:
+            Burst(const char* name, const char* category, uint64_t size)
+                : m_name(name),
+                  m_category(category),
+                  m_size(size),
+                  m_ticks(0),
+                  m_start(0)
+            { }
+
+            /**
+             * @brief Count a call of the operation
+             **/
+            void Tick()
+            {
+                if (not IsEnabled())
+                    return;
+
+                if (this->m_ticks++ == 0)
+                    this->m_start = Now();
+
+                if (this->m_ticks == this->m_size)
+                    this->Close();
+            }
+
+            /**
+             * @brief Record the open span, if it has any tick
+             **/
+            void Close()
+            {
+                if (this->m_ticks > 0)
+                    Complete(this->m_name,
+                             this->m_category,
+                             this->m_start,
+                             "ticks",
+                             this->m_ticks);
+
+                this->m_ticks = 0;
+            }
+    };
+
+    /**
+     * @brief Record events from construction to destruction, then write them
+     *
+     * Every thread that recorded events must have finished by the time the
+     * session is destroyed
+     */
+    class Session
+    {
+        private:
+            const char* m_path; /**< File of the trace, or nullptr */
+
+        public:
+            /**
+             * @brief Constructor
+             * @param path File of the trace, or nullptr to record nothing
+             */
+            explicit Session(const char* path);
+
+            /**
+             * @brief Destructor. Writes the events of every thread
+             **/
+            ~Session();
+
+            Session(const Session&)            = delete;
+            Session& operator=(const Session&) = delete;
+    };
+} // namespace trace
+
+#endif // TRACE_H_
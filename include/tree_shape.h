@@ -0,0 +1,99 @@
+/*
+ * Filename: tree_shape.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef TREE_SHAPE_H_
+#define TREE_SHAPE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "board.h"
+#include "constants.h"
+
+/**
+ * @brief Namespace containing the histograms of the shape of a search tree
+ *
+ * They show where a search spends its expansions: how many nodes each depth
+ * has, how many children they have on average, how constrained the chosen cells
+ * are and where the dead ends are. Comparing them across algorithms and
+ * propagation settings on the same tier shows which ones shrink the tree
+ **/
+namespace shape
+{
+    constexpr std::size_t DEPTHS = grid::BOARD_CELLS; /**< Depths of an expanded
+                                                          node, deeper ones share
+                                                          the last entry */
+    constexpr std::size_t WIDTHS = GRID_SIZE + 1; /**< Candidates of a cell */
+
+    /**
+     * @brief Histograms of a search, in fixed arrays
+     */
+    struct Histograms
+    {
+        uint64_t nodes[DEPTHS];      /**< Nodes expanded at each depth */
+        uint64_t children[DEPTHS];   /**< Children kept, by depth of the parent */
+        uint64_t deadEnds[DEPTHS];   /**< Expanded nodes left without children */
+        uint64_t candidates[WIDTHS]; /**< Expansions by candidates of the cell */
+
+        /**
+         * @brief Set every entry to zero
+         **/
+        void Clear();
+
+        /**
+         * @brief Add the entries of other histograms, of another thread or search
+         * @param other Histograms to add
+         **/
+        void Merge(const Histograms& other);
+
+        /**
+         * @brief Record an expansion
+         * @param depth Depth of the expanded node
+         * @param candidates Numbers the chosen cell accepts
+         * @param kept Children left after propagation
+         **/
+        void Expansion(std::size_t depth, std::size_t candidates, std::size_t kept)
+        {
+            depth = std::min(depth, DEPTHS - 1);
+
+            this->nodes[depth]++;
+            this->children[depth] += kept;
+            this->candidates[std::min(candidates, WIDTHS - 1)]++;
+
+            if (kept == 0)
+                this->deadEnds[depth]++;
+        }
+
+        /**
+         * @brief Get the effective branching factor at a depth
+         * @param depth Depth of the parents
+         * @return Children per expanded node, 0 if the depth has none
+         **/
+        double Branching(std::size_t depth) const
+        {
+            return this->nodes[depth] == 0
+                       ? 0.0
+                       : static_cast<double>(this->children[depth]) /
+                             this->nodes[depth];
+        }
+
+        /**
+         * @brief Get the deepest depth with an expanded node
+         * @return Depth plus one, 0 if nothing was expanded
+         **/
+        std::size_t Depths() const;
+    };
+
+    /**
+     * @brief Print the histograms as a table per depth and a line of candidates
+     * @param histograms Histograms to print
+     * @param runs Searches merged into the histograms, to print averages
+     **/
+    void Print(const Histograms& histograms, std::size_t runs = 1);
+} // namespace shape
+
+#endif // TREE_SHAPE_H_
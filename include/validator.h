@@ -0,0 +1,107 @@
+/*
+ * Filename: validator.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef VALIDATOR_H_
+#define VALIDATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "board.h"
+#include "constants.h"
+#include "kernels.h"
+#include "topology.h"
+
+/**
+ * @brief Namespace containing the bulk validator of puzzles and solutions
+ **/
+namespace validator
+{
+    constexpr uint8_t     BAD_CELL   = 0xFF; /**< Value of an invalid character */
+    constexpr std::size_t BATCH_SIZE = 4096; /**< Grids validated per kernel call */
+
+    static_assert(BATCH_SIZE % kernel::LANES == 0, "Batches hold whole blocks");
+
+    /**
+     * @brief Why a cell was rejected
+     */
+    enum class Reason : uint8_t
+    {
+        BAD_CHARACTER,   /**< The cell is not a digit nor '.' */
+        BAD_LENGTH,      /**< The record does not have GRID_SIZE * GRID_SIZE cells */
+        EMPTY_CELL,      /**< A solution has an empty cell */
+        DUPLICATE_ROW,   /**< The number already appears earlier in the row */
+        DUPLICATE_COL,   /**< The number already appears earlier in the column */
+        DUPLICATE_BOX,   /**< The number already appears earlier in the box */
+        DUPLICATE_EXTRA, /**< The number already appears earlier in an extra unit */
+    };
+
+    /**
+     * @brief Error found in a grid of a batch
+     */
+    struct Error
+    {
+        uint32_t index; /**< Index of the grid in the batch */
+        uint8_t  cell;  /**< Cell in row-major order */
+        Reason   reason;
+    };
+
+    /**
+     * @brief Get the position of a cell of a grid in the interleaved layout
+     * @param index Index of the grid
+     * @param cell Cell in row-major order
+     * @return Offset of the byte of the cell
+     **/
+    constexpr std::size_t Offset(std::size_t index, std::size_t cell)
+    {
+        return (index / kernel::LANES * grid::BOARD_CELLS + cell) * kernel::LANES +
+               index % kernel::LANES;
+    }
+
+    /**
+     * @brief Get the bytes needed to hold grids in the interleaved layout
+     * @param count Number of grids
+     * @return Size of the whole blocks holding them
+     **/
+    constexpr std::size_t Bytes(std::size_t count)
+    {
+        return (count + kernel::LANES - 1) / kernel::LANES * kernel::LANES *
+               grid::BOARD_CELLS;
+    }
+
+    /**
+     * @brief Get a printable name for a reason
+     * @param reason Reason to name
+     * @return Name of the reason
+     **/
+    const char* ReasonName(Reason reason);
+
+    /**
+     * @brief Validate many packed grids
+     *
+     * Each grid is GRID_SIZE * GRID_SIZE bytes, holding 0 for an empty cell, 1 to
+     * GRID_SIZE for a number and BAD_CELL for anything else. The grids are
+     * interleaved in blocks of kernel::LANES (see Offset), so the dispatched SIMD
+     * kernel checks a whole block at once, and only the rejected grids are gathered
+     * and scanned again to locate their errors. The lanes of the last block past
+     * count are ignored
+     *
+     * @param cells Packed grids, Bytes(count) of them
+     * @param count Number of grids
+     * @param solutions If true, the grids must be complete solutions
+     * @param topology Topology of the grids
+     * @param errors Receives the errors found. Indices are relative to cells
+     * @return Number of invalid grids
+     **/
+    std::size_t Validate(const uint8_t*        cells,
+                         std::size_t           count,
+                         bool                  solutions,
+                         const grid::Topology& topology,
+                         std::vector<Error>&   errors);
+} // namespace validator
+
+#endif // VALIDATOR_H_
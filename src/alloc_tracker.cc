@@ -0,0 +1,263 @@
+/*
+ * Filename: alloc_tracker.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "alloc_tracker.h"
+
+#ifdef SUDOKU_ALLOC_TRACKER
+
+#include <algorithm>
+#include <cstdlib>
+#include <malloc.h>
+#include <new>
+
+namespace alloc
+{
+    // State of the calling thread. Plain types only, so reaching them never
+    // allocates
+    static thread_local Tracker*    t_tracker = nullptr;
+    static thread_local uint8_t     t_open[MAX_DEPTH];
+    static thread_local std::size_t t_depth = 0;
+
+    Tracker::Tracker()
+        : m_stats(),
+          m_live(0),
+          m_previous(t_tracker)
+    {
+        this->m_stats.enabled = true;
+
+        t_tracker = this;
+    }
+
+    Tracker::~Tracker()
+    {
+        t_tracker = this->m_previous;
+    }
+
+    /**
+     * @brief Get the slot of the innermost phase of the calling thread
+     * @return Slot of the phase, NO_PHASE if none is open
+     **/
+    static uint8_t CurrentSlot()
+    {
+        return t_depth == 0 ? NO_PHASE : t_open[std::min(t_depth, MAX_DEPTH) - 1];
+    }
+
+    void Tracker::Allocated(std::size_t bytes)
+    {
+        Counts& counts = this->m_stats.phases[CurrentSlot()];
+
+        counts.allocations++;
+        counts.bytes += bytes;
+
+        this->m_live += bytes;
+
+        if (this->m_live > 0)
+            this->m_stats.peakLive =
+                std::max<uint64_t>(this->m_stats.peakLive, this->m_live);
+    }
+
+    void Tracker::Freed(std::size_t bytes)
+    {
+        this->m_stats.phases[CurrentSlot()].frees++;
+        this->m_live -= bytes;
+    }
+
+    Stats Tracker::Read() const
+    {
+        Stats stats = this->m_stats;
+
+        for (const Counts& counts : stats.phases)
+        {
+            stats.total.allocations += counts.allocations;
+            stats.total.frees += counts.frees;
+            stats.total.bytes += counts.bytes;
+        }
+
+        return stats;
+    }
+
+    void Enter(uint8_t phase)
+    {
+        // Deeper phases are charged to the deepest one kept
+        if (t_depth < MAX_DEPTH)
+            t_open[t_depth] = std::min(phase, NO_PHASE);
+
+        t_depth++;
+    }
+
+    void Leave()
+    {
+        if (t_depth > 0)
+            t_depth--;
+    }
+
+    /**
+     * @brief Allocate a block and record it
+     * @param size Bytes requested
+     * @param alignment Alignment of the block, 0 for the default
+     * @return Block, or nullptr if the allocation failed
+     **/
+    static void* Allocate(std::size_t size, std::size_t alignment)
+    {
+        // malloc(0) may return nullptr, but operator new must not
+        size = std::max<std::size_t>(size, 1);
+
+        void* block = alignment == 0 ? std::malloc(size)
+                                     : std::aligned_alloc(
+                                           alignment,
+                                           (size + alignment - 1) / alignment *
+                                               alignment);
+
+        if (block != nullptr and t_tracker != nullptr)
+            t_tracker->Allocated(malloc_usable_size(block));
+
+        return block;
+    }
+
+    /**
+     * @brief Allocate a block or throw, as operator new does
+     * @param size Bytes requested
+     * @param alignment Alignment of the block, 0 for the default
+     * @return Block
+     **/
+    static void* AllocateOrThrow(std::size_t size, std::size_t alignment)
+    {
+        void* block;
+
+        while ((block = Allocate(size, alignment)) == nullptr)
+        {
+            std::new_handler handler = std::get_new_handler();
+
+            if (handler == nullptr)
+                throw std::bad_alloc();
+
+            handler();
+        }
+
+        return block;
+    }
+
+    /**
+     * @brief Record the release of a block and free it
+     * @param block Block to free, may be nullptr
+     **/
+    static void Release(void* block)
+    {
+        if (block == nullptr)
+            return;
+
+        if (t_tracker != nullptr)
+            t_tracker->Freed(malloc_usable_size(block));
+
+        std::free(block);
+    }
+} // namespace alloc
+
+void* operator new(std::size_t size)
+{
+    return alloc::AllocateOrThrow(size, 0);
+}
+
+void* operator new[](std::size_t size)
+{
+    return alloc::AllocateOrThrow(size, 0);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return alloc::Allocate(size, 0);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return alloc::Allocate(size, 0);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return alloc::AllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return alloc::AllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size,
+                   std::align_val_t alignment,
+                   const std::nothrow_t&) noexcept
+{
+    return alloc::Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size,
+                     std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept
+{
+    return alloc::Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* block) noexcept
+{
+    alloc::Release(block);
+}
+
+void operator delete[](void* block) noexcept
+{
+    alloc::Release(block);
+}
+
+void operator delete(void* block, std::size_t) noexcept
+{
+    alloc::Release(block);
+}
+
+void operator delete[](void* block, std::size_t) noexcept
+{
+    alloc::Release(block);
+}
+
+void operator delete(void* block, const std::nothrow_t&) noexcept
+{
+    alloc::Release(block);
+}
+
+void operator delete[](void* block, const std::nothrow_t&) noexcept
+{
+    alloc::Release(block);
+}
+
+void operator delete(void* block, std::align_val_t) noexcept
+{
+    alloc::Release(block);
+}
+
+void operator delete[](void* block, std::align_val_t) noexcept
+{
+    alloc::Release(block);
+}
+
+void operator delete(void* block, std::size_t, std::align_val_t) noexcept
+{
+    alloc::Release(block);
+}
+
+void operator delete[](void* block, std::size_t, std::align_val_t) noexcept
+{
+    alloc::Release(block);
+}
+
+void operator delete(void* block, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    alloc::Release(block);
+}
+
+void operator delete[](void* block, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    alloc::Release(block);
+}
+
+#endif // SUDOKU_ALLOC_TRACKER
@@ -0,0 +1,332 @@
+/*
+ * Filename: annealing.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "annealing.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace annealing
+{
+    Annealer::Annealer(uint16_t                    boxSide,
+                       const std::vector<uint8_t>& cells,
+                       uint32_t                    seed)
+        : m_random(seed)
+    {
+        this->m_side  = boxSide * boxSide;
+        this->m_cells = static_cast<std::size_t>(this->m_side) * this->m_side;
+        this->m_grid  = cells;
+
+        this->m_grid.resize(this->m_cells, 0);
+        this->m_region.resize(this->m_cells);
+
+        for (std::size_t cell = 0; cell < this->m_cells; cell++)
+        {
+            std::size_t row = cell / this->m_side;
+            std::size_t col = cell % this->m_side;
+
+            this->m_region[cell] = (row / boxSide) * boxSide + col / boxSide;
+        }
+
+        this->Build({ });
+    }
+
+    Annealer::Annealer(const grid::Board&    board,
+                       const grid::Topology& topology,
+                       uint32_t              seed)
+        : m_random(seed)
+    {
+        this->m_side  = GRID_SIZE;
+        this->m_cells = grid::BOARD_CELLS;
+        this->m_grid.assign(board.cells, board.cells + grid::BOARD_CELLS);
+        this->m_region.assign(topology.region, topology.region + grid::BOARD_CELLS);
+
+        std::vector<std::vector<uint32_t>> extra(topology.extraCount);
+
+        for (std::size_t unit = 0; unit < topology.extraCount; unit++)
+        {
+            extra[unit].assign(topology.extra[unit], topology.extra[unit] + GRID_SIZE);
+        }
+
+        this->Build(extra);
+    }
+
+    Annealer::~Annealer() { }
+
+    void Annealer::Build(const std::vector<std::vector<uint32_t>>& extra)
+    {
+        std::vector<std::vector<uint16_t>> units(this->m_cells);
+
+        // Rows first, then columns, then the extra units. Regions are never scored
+        for (std::size_t cell = 0; cell < this->m_cells; cell++)
+        {
+            units[cell].push_back(cell / this->m_side);
+            units[cell].push_back(this->m_side + cell % this->m_side);
+        }
+
+        for (std::size_t unit = 0; unit < extra.size(); unit++)
+        {
+            for (uint32_t cell : extra[unit])
+            {
+                units[cell].push_back(2 * this->m_side + unit);
+            }
+        }
+
+        this->m_unitStart.assign(1, 0);
+        this->m_cellUnits.clear();
+
+        for (std::size_t cell = 0; cell < this->m_cells; cell++)
+        {
+            this->m_cellUnits.insert(this->m_cellUnits.end(),
+                                     units[cell].begin(),
+                                     units[cell].end());
+            this->m_unitStart.push_back(this->m_cellUnits.size());
+        }
+
+        std::size_t scoredUnits = 2 * this->m_side + extra.size();
+
+        this->m_counts.assign(scoredUnits * this->m_side, 0);
+        this->m_fixed.assign(this->m_cells, 0);
+        this->m_freeCells.assign(this->m_side, { });
+
+        for (std::size_t cell = 0; cell < this->m_cells; cell++)
+        {
+            if (this->m_grid[cell] != 0)
+                this->m_fixed[cell] = 1;
+            else
+                this->m_freeCells[this->m_region[cell]].push_back(cell);
+        }
+
+        this->m_movable.clear();
+
+        for (uint16_t region = 0; region < this->m_side; region++)
+        {
+            if (this->m_freeCells[region].size() >= 2)
+                this->m_movable.push_back(region);
+        }
+
+        this->m_iterations = 0;
+        this->m_trajectory.clear();
+
+        this->Fill();
+    }
+
+    void Annealer::Fill()
+    {
+        for (uint16_t region = 0; region < this->m_side; region++)
+        {
+            std::vector<bool>    used(this->m_side + 1, false);
+            std::vector<uint8_t> missing;
+
+            for (std::size_t cell = 0; cell < this->m_cells; cell++)
+            {
+                if (this->m_region[cell] == region and this->m_fixed[cell])
+                    used[this->m_grid[cell]] = true;
+            }
+
+            for (uint16_t num = 1; num <= this->m_side; num++)
+            {
+                if (not used[num])
+                    missing.push_back(num);
+            }
+
+            std::shuffle(missing.begin(), missing.end(), this->m_random);
+
+            // Repeated givens leave fewer missing numbers than free cells. The
+            // extra cells still get a number, and the search reports the conflicts
+            std::vector<uint32_t>& cells = this->m_freeCells[region];
+
+            for (std::size_t i = 0; i < cells.size(); i++)
+            {
+                this->m_grid[cells[i]] = i < missing.size() ? missing[i] : 1;
+            }
+        }
+
+        std::fill(this->m_counts.begin(), this->m_counts.end(), 0);
+        this->m_conflicts = 0;
+
+        for (std::size_t cell = 0; cell < this->m_cells; cell++)
+        {
+            this->m_conflicts += this->Count(cell, this->m_grid[cell], true);
+        }
+    }
+
+    int Annealer::Count(uint32_t cell, uint8_t num, bool add)
+    {
+        int delta = 0;
+
+        uint32_t end = this->m_unitStart[cell + 1];
+
+        for (uint32_t i = this->m_unitStart[cell]; i < end; i++)
+        {
+            uint16_t& count =
+                this->m_counts[this->m_cellUnits[i] * this->m_side + num - 1];
+
+            // A number conflicts once for each repetition past the first
+            if (add)
+                delta += count++ >= 1;
+            else
+                delta -= --count >= 1;
+        }
+
+        return delta;
+    }
+
+    int Annealer::Swap(uint32_t a, uint32_t b)
+    {
+        uint8_t x = this->m_grid[a];
+        uint8_t y = this->m_grid[b];
+
+        // Remove both numbers before placing them back, so a row or column shared
+        // by the two cells is counted correctly
+        int delta = this->Count(a, x, false) + this->Count(b, y, false) +
+                    this->Count(a, y, true) + this->Count(b, x, true);
+
+        this->m_grid[a] = y;
+        this->m_grid[b] = x;
+
+        this->m_conflicts += delta;
+
+        return delta;
+    }
+
+    bool Annealer::PickMove(uint32_t& a, uint32_t& b)
+    {
+        if (this->m_movable.empty())
+            return false;
+
+        std::uniform_int_distribution<std::size_t> pickRegion(
+            0, this->m_movable.size() - 1);
+
+        std::vector<uint32_t>& cells =
+            this->m_freeCells[this->m_movable[pickRegion(this->m_random)]];
+
+        std::uniform_int_distribution<std::size_t> pickCell(0, cells.size() - 1);
+
+        std::size_t i = pickCell(this->m_random);
+        std::size_t j = pickCell(this->m_random);
+
+        while (j == i)
+        {
+            j = pickCell(this->m_random);
+        }
+
+        a = cells[i];
+        b = cells[j];
+
+        return true;
+    }
+
+    double Annealer::InitialTemperature()
+    {
+        constexpr std::size_t PROBES = 200;
+
+        double sum       = 0;
+        double sumSquare = 0;
+
+        uint32_t a, b;
+
+        for (std::size_t i = 0; i < PROBES; i++)
+        {
+            // Only when no move exists at all, and then Run stops right away
+            if (not this->PickMove(a, b))
+                return 1.0;
+
+            int delta = this->Swap(a, b);
+            this->Swap(a, b);
+
+            sum += delta;
+            sumSquare += static_cast<double>(delta) * delta;
+        }
+
+        double mean     = sum / PROBES;
+        double variance = sumSquare / PROBES - mean * mean;
+
+        return std::max(std::sqrt(std::max(variance, 0.0)), 0.5);
+    }
+
+    bool Annealer::Run(std::size_t budget)
+    {
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+        this->m_trajectory.push_back({ this->m_iterations, this->m_conflicts });
+
+        std::size_t freeCells = 0;
+
+        for (const std::vector<uint32_t>& cells : this->m_freeCells)
+        {
+            freeCells += cells.size();
+        }
+
+        // One chain tries about as many moves as there are pairs of free cells
+        std::size_t chainLength = std::max<std::size_t>(freeCells * freeCells, 1);
+        std::size_t sampleEvery = std::max<std::size_t>(budget / TRAJECTORY_SAMPLES, 1);
+
+        double startTemperature = this->InitialTemperature();
+        double temperature      = startTemperature;
+
+        uint32_t    best   = this->m_conflicts;
+        std::size_t stale  = 0;
+        bool        moving = true;
+
+        while (moving and this->m_conflicts > 0 and this->m_iterations < budget)
+        {
+            for (std::size_t i = 0; i < chainLength and this->m_conflicts > 0 and
+                                    this->m_iterations < budget;
+                 i++)
+            {
+                uint32_t a, b;
+
+                if (not this->PickMove(a, b))
+                {
+                    moving = false;
+                    break;
+                }
+
+                int delta = this->Swap(a, b);
+                this->m_iterations++;
+
+                // Worse moves are accepted with probability e^(-delta / T)
+                if (delta > 0 and
+                    uniform(this->m_random) >= std::exp(-delta / temperature))
+                    this->Swap(a, b);
+
+                if (this->m_iterations % sampleEvery == 0)
+                {
+                    this->m_trajectory.push_back(
+                        { this->m_iterations, this->m_conflicts });
+                }
+            }
+
+            if (this->m_conflicts < best)
+            {
+                best  = this->m_conflicts;
+                stale = 0;
+            }
+            else
+            {
+                stale++;
+            }
+
+            // Stuck in a local minimum, so reheat instead of freezing there. A
+            // full reheat would throw away most of the progress
+            if (stale >= STALE_CHAINS)
+            {
+                temperature = startTemperature * REHEAT_FRACTION;
+                stale       = 0;
+            }
+            else
+            {
+                temperature *= COOLING_RATE;
+            }
+        }
+
+        if (this->m_trajectory.back().iteration != this->m_iterations)
+            this->m_trajectory.push_back({ this->m_iterations, this->m_conflicts });
+
+        return this->m_conflicts == 0;
+    }
+} // namespace annealing
@@ -0,0 +1,17 @@
+/*
+ * Filename: board.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "board.h"
+
+#include <cstring>
+
+namespace grid
+{
+    void Board::Clear()
+    {
+        std::memset(this, 0, sizeof(Board));
+    }
+} // namespace grid
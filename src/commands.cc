@@ -0,0 +1,870 @@
+/*
+ * Filename: commands.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "commands.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "annealing.h"
+#include "board.h"
+#include "enumeration.h"
+#include "kernels.h"
+#include "latency.h"
+#include "memory_usage.h"
+#include "search_log.h"
+#include "topology.h"
+#include "trace.h"
+#include "validator.h"
+
+namespace command
+{
+    constexpr std::size_t READ_BLOCK = 1 << 20; /**< Bytes read per fread call */
+
+    // Grid counts overflow 64 bits. Marked as an extension, since -pedantic warns
+    // about __int128
+    __extension__ typedef unsigned __int128 uint128_t;
+
+    /**
+     * @brief Grids of a file waiting to be validated
+     */
+    struct PendingGrids
+    {
+        const char*           file;      /**< Name of the file */
+        std::vector<uint8_t>  cells;     /**< Grids, interleaved (see validator) */
+        std::vector<uint32_t> records;   /**< Line of each grid in the file */
+        std::vector<uint32_t> badLength; /**< Lines with the wrong number of cells */
+    };
+
+    /**
+     * @brief Pack the cells of a line, skipping blanks
+     * @param line Line to pack
+     * @param length Length of the line
+     * @param cells Receives up to GRID_SIZE * GRID_SIZE packed cells
+     * @param stride Distance between two cells in cells
+     * @return Number of cells in the line
+     **/
+    static std::size_t
+    PackLine(const char* line, std::size_t length, uint8_t* cells, std::size_t stride)
+    {
+        // Fast path for a line of exactly the cells: convert without branches and
+        // only fall back to the scan below if a blank turns up
+        if (length == grid::BOARD_CELLS)
+        {
+            uint8_t blank = 0;
+
+            for (std::size_t i = 0; i < grid::BOARD_CELLS; i++)
+            {
+                uint8_t c     = line[i];
+                uint8_t digit = c - '0';
+
+                blank |= (c == ' ') | (c == '\t') | (c == '\r');
+                cells[i * stride] = digit <= 9   ? digit
+                                    : c == '.' ? 0
+                                               : validator::BAD_CELL;
+            }
+
+            if (not blank)
+                return grid::BOARD_CELLS;
+        }
+
+        std::size_t count = 0;
+
+        for (std::size_t i = 0; i < length; i++)
+        {
+            char c = line[i];
+
+            if (c == ' ' or c == '\t' or c == '\r')
+                continue;
+
+            if (count < grid::BOARD_CELLS)
+            {
+                cells[count * stride] = c >= '0' and c <= '9' ? c - '0'
+                                        : c == '.'            ? 0
+                                                              : validator::BAD_CELL;
+            }
+
+            count++;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Print an error found in a file
+     * @param file Name of the file
+     * @param record Line of the grid in the file
+     * @param error Error to print
+     **/
+    static void
+    PrintError(const char* file, uint32_t record, const validator::Error& error)
+    {
+        std::printf("%s:%u: cell (%u, %u): %s\n",
+                    file,
+                    record + 1,
+                    error.cell / GRID_SIZE,
+                    error.cell % GRID_SIZE,
+                    validator::ReasonName(error.reason));
+    }
+
+    /**
+     * @brief Validate the grids waiting in a batch and print their errors, along
+     * with the lines of the wrong length, in the order of the file
+     * @param pending Grids to validate, cleared afterwards
+     * @param solutions If true, the grids must be complete solutions
+     * @param topology Topology of the grids
+     * @param errors Buffer reused for the errors
+     * @return Number of invalid grids
+     **/
+    static std::size_t Flush(PendingGrids&                  pending,
+                             bool                           solutions,
+                             const grid::Topology&          topology,
+                             std::vector<validator::Error>& errors)
+    {
+        errors.clear();
+
+        std::size_t invalid = validator::Validate(pending.cells.data(),
+                                                  pending.records.size(),
+                                                  solutions,
+                                                  topology,
+                                                  errors);
+
+        const validator::Error badLength = { 0, 0, validator::Reason::BAD_LENGTH };
+        std::size_t            next      = 0;
+
+        // Both lists are sorted by line, so merge them
+        for (const validator::Error& error : errors)
+        {
+            uint32_t record = pending.records[error.index];
+
+            while (next < pending.badLength.size() and pending.badLength[next] < record)
+            {
+                PrintError(pending.file, pending.badLength[next++], badLength);
+            }
+
+            PrintError(pending.file, record, error);
+        }
+
+        while (next < pending.badLength.size())
+        {
+            PrintError(pending.file, pending.badLength[next++], badLength);
+        }
+
+        pending.cells.clear();
+        pending.records.clear();
+        pending.badLength.clear();
+
+        return invalid;
+    }
+
+    int Validate(int argc, char* argv[])
+    {
+        bool                     solutions = false;
+        const grid::Topology*    topology  = &grid::CLASSIC;
+        grid::Topology           custom;
+        std::vector<const char*> files;
+
+        for (int i = 0; i < argc; i++)
+        {
+            if (std::strcmp(argv[i], "--solutions") == 0)
+            {
+                solutions = true;
+            }
+            else if (std::strncmp(argv[i], "--variant=", 10) == 0)
+            {
+                topology = grid::FindTopology(argv[i] + 10, custom);
+
+                if (topology == nullptr)
+                {
+                    std::fprintf(stderr, "Unknown variant: %s\n", argv[i] + 10);
+                    return EXIT_FAILURE;
+                }
+            }
+            else if (std::strncmp(argv[i], "--", 2) == 0)
+            {
+                std::fprintf(stderr, "Unknown option: %s\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+            else
+            {
+                files.push_back(argv[i]);
+            }
+        }
+
+        if (files.empty())
+        {
+            std::fprintf(stderr,
+                         "Usage: validate [--solutions] [--variant=<name>] "
+                         "<file>...\n");
+            return EXIT_FAILURE;
+        }
+
+        PendingGrids                  pending;
+        std::vector<validator::Error> errors;
+        std::vector<char>             buffer(READ_BLOCK);
+
+        std::size_t grids   = 0;
+        std::size_t invalid = 0;
+        std::size_t bytes   = 0;
+        bool        failed  = false;
+
+        pending.cells.reserve(validator::Bytes(validator::BATCH_SIZE));
+        pending.records.reserve(validator::BATCH_SIZE);
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (const char* file : files)
+        {
+            std::FILE* stream = std::fopen(file, "rb");
+
+            if (stream == nullptr)
+            {
+                std::fprintf(stderr, "Could not open %s\n", file);
+                failed = true;
+                continue;
+            }
+
+            pending.file = file;
+
+            uint32_t    record = 0;
+            std::size_t kept   = 0; // Bytes of an unfinished line kept from the
+                                    // previous block
+            bool        eof    = false;
+
+            while (not eof)
+            {
+                std::size_t read =
+                    std::fread(buffer.data() + kept, 1, buffer.size() - kept, stream);
+
+                bytes += read;
+                eof = read == 0;
+
+                std::size_t end   = kept + read;
+                std::size_t begin = 0;
+
+                while (begin < end)
+                {
+                    const char* newline = static_cast<const char*>(
+                        std::memchr(buffer.data() + begin, '\n', end - begin));
+
+                    // Keep an unfinished line for the next block, unless there is
+                    // no more data or the line alone fills the whole buffer
+                    if (newline == nullptr and not eof and
+                        (begin > 0 or end < buffer.size()))
+                        break;
+
+                    std::size_t length =
+                        (newline == nullptr ? end : newline - buffer.data()) - begin;
+
+                    // Pack straight into the lane of the next grid. A rejected
+                    // line is overwritten by the next grid, or left in a lane past
+                    // the end of the batch, which the validator ignores
+                    std::size_t index = pending.records.size();
+                    pending.cells.resize(validator::Bytes(index + 1));
+
+                    std::size_t count =
+                        PackLine(buffer.data() + begin,
+                                 length,
+                                 pending.cells.data() + validator::Offset(index, 0),
+                                 kernel::LANES);
+
+                    if (count == grid::BOARD_CELLS)
+                    {
+                        pending.records.push_back(record);
+                        grids++;
+                    }
+                    else if (count != 0) // Blank lines are not grids
+                    {
+                        pending.badLength.push_back(record);
+                        grids++;
+                        invalid++;
+                    }
+
+                    if (pending.records.size() == validator::BATCH_SIZE)
+                        invalid += Flush(pending, solutions, *topology, errors);
+
+                    record++;
+                    begin += length + 1;
+                }
+
+                kept = begin < end ? end - begin : 0;
+                std::memmove(buffer.data(), buffer.data() + begin, kept);
+            }
+
+            if (std::ferror(stream))
+            {
+                std::fprintf(stderr, "Could not read %s\n", file);
+                failed = true;
+            }
+
+            std::fclose(stream);
+
+            invalid += Flush(pending, solutions, *topology, errors);
+        }
+
+        double seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                .count();
+
+        std::printf("Validated %zu %s in %zu files: %zu invalid\n",
+                    grids,
+                    solutions ? "solutions" : "puzzles",
+                    files.size(),
+                    invalid);
+        std::printf("Throughput: %.1f MB/s\n",
+                    seconds > 0 ? bytes / seconds / 1e6 : 0.0);
+
+        return failed or invalid != 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
+    /**
+     * @brief Format an unsigned 128-bit integer, which printf cannot do
+     * @param value Value to format
+     * @param text Receives the digits, at least 40 bytes
+     * @return text
+     **/
+    static const char* FormatU128(uint128_t value, char* text)
+    {
+        char        digits[40];
+        std::size_t count = 0;
+
+        do
+        {
+            digits[count++] = '0' + static_cast<int>(value % 10);
+            value /= 10;
+        } while (value != 0);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            text[i] = digits[count - 1 - i];
+        }
+
+        text[count] = '\0';
+
+        return text;
+    }
+
+    /**
+     * @brief Parse a positive integer option given as --name=value
+     * @param option Option to parse
+     * @param name Name of the option, including the dashes and the '='
+     * @param value Receives the value
+     * @return True if the option has this name and a valid value
+     **/
+    static bool ParseCount(const char* option, const char* name, std::size_t& value)
+    {
+        std::size_t length = std::strlen(name);
+
+        if (std::strncmp(option, name, length) != 0)
+            return false;
+
+        char* end;
+        value = std::strtoull(option + length, &end, 10);
+
+        return *end == '\0' and end != option + length and value > 0;
+    }
+
+    int Enumerate(int argc, char* argv[])
+    {
+        std::size_t limit   = SIZE_MAX;
+        std::size_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+        for (int i = 0; i < argc; i++)
+        {
+            if (not ParseCount(argv[i], "--bands=", limit) and
+                not ParseCount(argv[i], "--threads=", threads))
+            {
+                std::fprintf(stderr,
+                             "Usage: enumerate [--bands=<n>] [--threads=<n>]\n");
+                return EXIT_FAILURE;
+            }
+        }
+
+        std::vector<enumeration::Band> bands = enumeration::CanonicalBands();
+        std::size_t                    total = bands.size();
+
+        if (limit < total)
+            bands.resize(limit);
+
+        std::printf("Enumerating %zu of %zu canonical first bands on %zu threads\n",
+                    bands.size(),
+                    total,
+                    threads);
+
+        enumeration::Result result = enumeration::Enumerate(bands, threads);
+
+        char text[40];
+
+        std::printf("Canonical grids: %" PRIu64 "\n", result.grids);
+        std::printf("Equivalent grids: %s\n",
+                    FormatU128(static_cast<uint128_t>(result.grids) *
+                                   enumeration::EQUIVALENT_FORMS,
+                               text));
+
+        // Bands are not equally productive, so this is only a rough figure
+        if (result.bands < total and result.bands > 0)
+        {
+            double estimate =
+                static_cast<double>(result.grids) / result.bands * total;
+
+            std::printf("Estimated canonical grids of all bands: %.4g\n", estimate);
+            std::printf("Estimated grids of all bands: %.4g\n",
+                        estimate * enumeration::EQUIVALENT_FORMS);
+        }
+
+        std::printf("Cells assigned: %" PRIu64 "\n", result.nodes);
+        std::printf("Last bands from cache: %" PRIu64 "\n", result.cacheHits);
+        std::printf("Total time: %.3f s\n", result.seconds);
+        std::printf("Throughput: %.3g grids/s\n",
+                    result.seconds > 0 ? result.grids / result.seconds : 0.0);
+
+        return EXIT_SUCCESS;
+    }
+
+    /**
+     * @brief Read the cells of a grid of any size
+     * @param path File with the cells, split by blanks or line breaks
+     * @param cells Receives the cells in row-major order, 0 for an empty cell
+     * @return False if the file cannot be read or holds anything but numbers
+     * and '.'
+     **/
+    static bool ReadCells(const char* path, std::vector<uint8_t>& cells)
+    {
+        std::FILE* stream = std::fopen(path, "r");
+
+        if (stream == nullptr)
+            return false;
+
+        bool valid = true;
+        char token[8];
+
+        // Numbers of the largest grid have 3 digits, so longer tokens are invalid
+        while (valid and std::fscanf(stream, "%7s", token) == 1)
+        {
+            char*         end;
+            unsigned long num = std::strtoul(token, &end, 10);
+
+            if (std::strcmp(token, ".") == 0)
+                cells.push_back(0);
+            else if (*end == '\0' and end != token and num <= UINT8_MAX)
+                cells.push_back(static_cast<uint8_t>(num));
+            else
+                valid = false;
+        }
+
+        valid = valid and not std::ferror(stream);
+        std::fclose(stream);
+
+        return valid;
+    }
+
+    int Anneal(int argc, char* argv[])
+    {
+        auto        now        = std::chrono::system_clock::now();
+        std::size_t iterations = 0; // Set from the size of the grid if not given
+        std::size_t seed       = now.time_since_epoch().count();
+        const char* path       = nullptr;
+
+        for (int i = 0; i < argc; i++)
+        {
+            if (ParseCount(argv[i], "--iterations=", iterations) or
+                ParseCount(argv[i], "--seed=", seed))
+                continue;
+
+            if (path != nullptr or std::strncmp(argv[i], "--", 2) == 0)
+            {
+                path = nullptr;
+                break;
+            }
+
+            path = argv[i];
+        }
+
+        if (path == nullptr)
+        {
+            std::fprintf(stderr,
+                         "Usage: anneal [--iterations=<n>] [--seed=<n>] <file>\n");
+            return EXIT_FAILURE;
+        }
+
+        std::vector<uint8_t> cells;
+
+        if (not ReadCells(path, cells))
+        {
+            std::fprintf(stderr, "%s: could not read the cells\n", path);
+            return EXIT_FAILURE;
+        }
+
+        // The cells of the grid are the fourth power of the box side. Numbers are
+        // stored in a byte, so the box side goes up to 15
+        uint16_t boxSide = std::lround(std::sqrt(std::sqrt(cells.size())));
+        uint16_t side    = boxSide * boxSide;
+
+        if (boxSide < 2 or boxSide > 15 or
+            static_cast<std::size_t>(side) * side != cells.size())
+        {
+            std::fprintf(stderr,
+                         "%s: %zu cells do not make a grid with a box side from 2 "
+                         "to 15\n",
+                         path,
+                         cells.size());
+            return EXIT_FAILURE;
+        }
+
+        std::size_t freeCells = 0;
+
+        for (uint8_t num : cells)
+        {
+            if (num > side)
+            {
+                std::fprintf(stderr, "%s: number %u out of 1..%u\n", path, num, side);
+                return EXIT_FAILURE;
+            }
+
+            freeCells += num == 0;
+        }
+
+        // The budget of the local search of the solver, scaled by the cells
+        if (iterations == 0)
+            iterations =
+                sudoku::SolverOptions().iterations * cells.size() / grid::BOARD_CELLS;
+
+        std::printf("Annealing a %ux%u grid (box side %u, %zu free cells, seed %zu)\n",
+                    side,
+                    side,
+                    boxSide,
+                    freeCells,
+                    seed);
+
+        auto start = std::chrono::steady_clock::now();
+
+        annealing::Annealer annealer(boxSide, cells, static_cast<uint32_t>(seed));
+        bool                solved = annealer.Run(iterations);
+
+        double seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                .count();
+
+        // Wide enough for the largest number of this grid
+        int width = side < 10 ? 1 : side < 100 ? 2 : 3;
+
+        for (std::size_t row = 0; row < side; row++)
+        {
+            for (std::size_t col = 0; col < side; col++)
+            {
+                const char* gap = col == 0 ? "" : col % boxSide == 0 ? " | " : " ";
+
+                std::printf("%s%*u", gap, width, annealer.Cells()[row * side + col]);
+            }
+
+            std::printf("\n");
+        }
+
+        std::printf("%s\n", solved ? "Solution found :')" : "No solution found :(");
+        std::printf("Conflicts left: %u\n", annealer.Conflicts());
+        std::printf("Total moves: %zu\n", annealer.Iterations());
+        std::printf("Total time: %.0f ms\n", seconds * 1e3);
+        std::printf("Conflict trajectory:");
+
+        for (const annealing::Sample& sample : annealer.Trajectory())
+        {
+            std::printf(" %zu:%u", sample.iteration, sample.conflicts);
+        }
+
+        std::printf("\n");
+
+        return solved ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    int Replay(int argc, char* argv[])
+    {
+        if (argc != 1)
+        {
+            std::fprintf(stderr, "Usage: replay <log>\n");
+            return EXIT_FAILURE;
+        }
+
+        searchlog::Log log(argv[0]);
+
+        if (not log.IsOpen())
+        {
+            std::fprintf(stderr, "%s: not a search log\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        const searchlog::Header& header = log.GetHeader();
+
+        // Jigsaw tables must outlive the solver
+        static grid::Topology custom;
+
+        sudoku::SolverOptions options;
+        uint16_t              grid[GRID_SIZE][GRID_SIZE];
+
+        options.propagate = header.propagate;
+        options.seed      = header.seed;
+        options.topology  = grid::FindTopology(header.variant.c_str(), custom);
+        options.replay    = &log;
+
+        if (options.topology == nullptr)
+        {
+            std::fprintf(
+                stderr, "%s: unknown variant %s\n", argv[0], header.variant.c_str());
+            return EXIT_FAILURE;
+        }
+
+        for (std::size_t cell = 0; cell < grid::BOARD_CELLS; cell++)
+        {
+            grid[cell / GRID_SIZE][cell % GRID_SIZE] = header.cells[cell];
+        }
+
+        sudoku::Solver(grid, static_cast<Algorithm>(header.algorithm), options).Solve();
+
+        if (log.Diverged())
+        {
+            std::printf("\nReplay diverged at %s\n", log.Divergence().c_str());
+            return EXIT_FAILURE;
+        }
+
+        std::printf("\nReplay matched %llu events of the log\n",
+                    static_cast<unsigned long long>(log.EventsRead()));
+
+        return EXIT_SUCCESS;
+    }
+
+    /**
+     * @brief Solve a puzzle and fill its record
+     * @param grid Initial grid
+     * @param algorithm Algorithm to solve the puzzle
+     * @param options Options of the search
+     * @param record Receives the outcome and counters. Its solution points into
+     * result
+     * @param result Receives the result of the search
+     **/
+    static void Solve(uint16_t                     grid[GRID_SIZE][GRID_SIZE],
+                      Algorithm                    algorithm,
+                      const sudoku::SolverOptions& options,
+                      output::Record&              record,
+                      sudoku::SolveResult&         result)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        sudoku::Solver solver(grid, algorithm, options);
+        result = solver.Run();
+
+        auto end = std::chrono::steady_clock::now();
+
+        record.status = not result.valid ? output::Status::INVALID
+                        : result.solved  ? output::Status::SOLVED
+                                         : output::Status::UNSOLVED;
+
+        record.solution    = result.solved ? &result.solution : nullptr;
+        record.phases      = result.phases.enabled ? &result.phases : nullptr;
+        record.memory      = result.memory.enabled ? &result.memory : nullptr;
+        record.searchNs    = result.nanoseconds;
+        record.expanded    = result.expansions;
+        record.generated   = result.expandedStates;
+        record.propagated  = result.propagated;
+        record.moves       = result.moves;
+        record.processPeak = memory::PeakRss();
+        record.totalNs =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    }
+
+    /**
+     * @brief Write a text as a JSON string, quotes included
+     * @param file Destination
+     * @param text Text to escape, such as a path given by the user
+     **/
+    static void WriteJsonString(std::FILE* file, const char* text)
+    {
+        std::fputc('"', file);
+
+        for (; *text != '\0'; text++)
+        {
+            unsigned char c = static_cast<unsigned char>(*text);
+
+            if (c == '"' or c == '\\')
+            {
+                std::fputc('\\', file);
+                std::fputc(c, file);
+            }
+            else if (c < 0x20)
+            {
+                std::fprintf(file, "\\u%04x", c);
+            }
+            else
+            {
+                std::fputc(c, file);
+            }
+        }
+
+        std::fputc('"', file);
+    }
+
+    /**
+     * @brief Print the latency of the searches of a batch to the standard error
+     * @param input File of the puzzles
+     * @param algorithm Algorithm of the searches
+     * @param histogram Search times of the puzzles
+     * @param format JSON writes one object, the other formats a line of text
+     **/
+    static void PrintLatency(const char*               input,
+                             Algorithm                 algorithm,
+                             const latency::Histogram& histogram,
+                             output::Format            format)
+    {
+        latency::Percentiles summary = histogram.Summary();
+
+        if (format == output::Format::JSON)
+        {
+            std::fprintf(stderr, "{ \"input\": ");
+            WriteJsonString(stderr, input);
+            std::fprintf(stderr,
+                         ", \"algorithm\": \"%s\", \"latency\": ",
+                         sudoku::AlgorithmName(algorithm));
+            latency::WriteJson(stderr, summary);
+            std::fprintf(stderr, " }\n");
+            return;
+        }
+
+        std::fprintf(stderr,
+                     "Latency of %s over %llu puzzles of %s (ns): p50 %llu, p90 %llu, "
+                     "p99 %llu, p99.9 %llu, max %llu\n",
+                     sudoku::AlgorithmName(algorithm),
+                     static_cast<unsigned long long>(summary.count),
+                     input,
+                     static_cast<unsigned long long>(summary.p50),
+                     static_cast<unsigned long long>(summary.p90),
+                     static_cast<unsigned long long>(summary.p99),
+                     static_cast<unsigned long long>(summary.p999),
+                     static_cast<unsigned long long>(summary.max));
+    }
+
+    int SolveFile(const char*                  input,
+                  Algorithm                    algorithm,
+                  const sudoku::SolverOptions& options,
+                  output::Format               format)
+    {
+        bool       standard = std::strcmp(input, "-") == 0;
+        std::FILE* stream   = standard ? stdin : std::fopen(input, "r");
+
+        if (stream == nullptr)
+        {
+            std::fprintf(stderr, "Could not open %s\n", input);
+            return EXIT_FAILURE;
+        }
+
+        output::Writer      writer(stdout);
+        sudoku::SolveResult result;
+        latency::Histogram  latencies; // Search times of the valid puzzles
+
+        char*       line      = nullptr;
+        std::size_t capacity  = 0;
+        ssize_t     length    = 0;
+        std::size_t number    = 0; // Line in the file
+        std::size_t index     = 0; // Puzzle, blank lines are skipped
+        bool        malformed = false;
+
+        output::WriteHeader(writer, format);
+
+        while ((length = getline(&line, &capacity, stream)) >= 0)
+        {
+            number++;
+
+            if (length > 0 and line[length - 1] == '\n')
+                length--;
+
+            uint8_t     cells[grid::BOARD_CELLS];
+            std::size_t count;
+
+            {
+                trace::Span span("parse", "input");
+                count = PackLine(line, length, cells, 1);
+            }
+
+            if (count == 0)
+                continue;
+
+            output::Record record = { index, output::Status::MALFORMED,
+                                      sudoku::AlgorithmName(algorithm),
+                                      nullptr, 0, 0, 0, 0, 0, 0, 0, nullptr, nullptr };
+
+            uint16_t grid[GRID_SIZE][GRID_SIZE];
+            bool     wellFormed = count == grid::BOARD_CELLS;
+
+            for (std::size_t cell = 0; wellFormed and cell < count; cell++)
+            {
+                wellFormed = cells[cell] != validator::BAD_CELL;
+                grid[cell / GRID_SIZE][cell % GRID_SIZE] = cells[cell];
+            }
+
+            if (not wellFormed)
+            {
+                std::fprintf(stderr, "%s:%zu: not a grid\n", input, number);
+                malformed = true;
+            }
+
+            if (format == output::Format::TEXT)
+            {
+                if (wellFormed)
+                    result = sudoku::Solver(grid, algorithm, options).Solve();
+            }
+            else
+            {
+                if (wellFormed)
+                    Solve(grid, algorithm, options, record, result);
+                else
+                    record.processPeak = memory::PeakRss();
+
+                output::WriteRecord(writer, format, record);
+            }
+
+            if (wellFormed and result.valid)
+                latencies.Record(result.nanoseconds);
+
+            index++;
+        }
+
+        std::free(line);
+
+        if (not standard)
+            std::fclose(stream);
+
+        // After the records, which may still be in the buffer of the writer
+        writer.Flush();
+
+        if (latencies.Count() > 0)
+            PrintLatency(input, algorithm, latencies, format);
+
+        return malformed ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
+    void WriteSolution(uint16_t                     grid[GRID_SIZE][GRID_SIZE],
+                       Algorithm                    algorithm,
+                       const sudoku::SolverOptions& options,
+                       output::Format               format)
+    {
+        output::Writer      writer(stdout);
+        sudoku::SolveResult result;
+
+        output::Record record = { 0, output::Status::MALFORMED,
+                                  sudoku::AlgorithmName(algorithm),
+                                  nullptr, 0, 0, 0, 0, 0, 0, 0, nullptr, nullptr };
+
+        Solve(grid, algorithm, options, record, result);
+
+        output::WriteHeader(writer, format);
+        output::WriteRecord(writer, format, record);
+    }
+} // namespace command
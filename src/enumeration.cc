@@ -0,0 +1,494 @@
+/*
+ * Filename: enumeration.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "enumeration.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <thread>
+
+#include "trace.h"
+
+namespace enumeration
+{
+    constexpr uint16_t FULL_MASK = (1 << GRID_SIZE) - 1;
+
+    // Cells searched in the second band: every column but the first, which is chosen
+    // up front
+    constexpr std::size_t BAND_COLS  = GRID_SIZE - 1;
+    constexpr std::size_t BAND_CELLS = SUBGRID_SIZE * BAND_COLS;
+
+    constexpr std::size_t MAX_CACHED_BANDS = 1 << 22; /**< Entries per thread */
+
+    /**
+     * @brief Masks of a partial grid
+     */
+    struct Masks
+    {
+        uint16_t rows[GRID_SIZE];
+        uint16_t cols[GRID_SIZE];
+        uint16_t boxes[GRID_SIZE];
+
+        /**
+         * @brief Place or remove a number
+         * @param row Row of the cell
+         * @param col Column of the cell
+         * @param bit Bit of the number
+         **/
+        void Toggle(uint16_t row, uint16_t col, uint16_t bit)
+        {
+            uint16_t box = (row / SUBGRID_SIZE) * SUBGRID_SIZE + col / SUBGRID_SIZE;
+
+            this->rows[row] ^= bit;
+            this->cols[col] ^= bit;
+            this->boxes[box] ^= bit;
+        }
+    };
+
+    /**
+     * @brief Complete the rows of the first band after the first one
+     * @param band Band being built
+     * @param masks Masks of the band
+     * @param cell Next cell to fill, from the second row on
+     * @param bands Receives the complete bands
+     **/
+    static void
+    FillBand(Band& band, Masks& masks, std::size_t cell, std::vector<Band>& bands)
+    {
+        if (cell == band.size())
+        {
+            bands.push_back(band);
+            return;
+        }
+
+        uint16_t row = cell / GRID_SIZE;
+        uint16_t col = cell % GRID_SIZE;
+
+        // The first box is fixed
+        if (col < SUBGRID_SIZE)
+        {
+            FillBand(band, masks, cell + 1, bands);
+            return;
+        }
+
+        uint16_t candidates = FULL_MASK & ~(masks.rows[row] | masks.cols[col] |
+                                            masks.boxes[col / SUBGRID_SIZE]);
+
+        for (uint16_t num = 1; num <= GRID_SIZE; num++)
+        {
+            uint16_t bit = 1 << (num - 1);
+
+            if (not(candidates & bit))
+                continue;
+
+            band[cell] = num;
+            masks.Toggle(row, col, bit);
+
+            FillBand(band, masks, cell + 1, bands);
+
+            masks.Toggle(row, col, bit);
+        }
+    }
+
+    std::vector<Band> CanonicalBands()
+    {
+        std::vector<Band> bands;
+
+        // The first row holds the numbers after the first box. Its second stack
+        // takes the lowest of them plus any two others, and both stacks ascend
+        const uint16_t first = SUBGRID_SIZE + 1;
+
+        for (uint16_t a = first + 1; a <= GRID_SIZE; a++)
+        {
+            for (uint16_t b = a + 1; b <= GRID_SIZE; b++)
+            {
+                Band  band  = { };
+                Masks masks = { };
+
+                for (uint16_t row = 0; row < SUBGRID_SIZE; row++)
+                {
+                    for (uint16_t col = 0; col < SUBGRID_SIZE; col++)
+                    {
+                        uint16_t num = row * SUBGRID_SIZE + col + 1;
+
+                        band[row * GRID_SIZE + col] = num;
+                        masks.Toggle(row, col, 1 << (num - 1));
+                    }
+                }
+
+                uint16_t col = SUBGRID_SIZE;
+
+                for (uint16_t num = first; num <= GRID_SIZE; num++)
+                {
+                    if (num == first or num == a or num == b)
+                    {
+                        band[col] = num;
+                        masks.Toggle(0, col++, 1 << (num - 1));
+                    }
+                }
+
+                for (uint16_t num = first; num <= GRID_SIZE; num++)
+                {
+                    if (num != first and num != a and num != b)
+                    {
+                        band[col] = num;
+                        masks.Toggle(0, col++, 1 << (num - 1));
+                    }
+                }
+
+                FillBand(band, masks, GRID_SIZE, bands);
+            }
+        }
+
+        return bands;
+    }
+
+    /**
+     * @brief Index of each mask with SUBGRID_SIZE bits among all such masks
+     */
+    struct TripleIndex
+    {
+        uint8_t index[1 << GRID_SIZE];
+
+        constexpr TripleIndex() : index()
+        {
+            uint8_t next = 0;
+
+            for (uint16_t mask = 0; mask < (1 << GRID_SIZE); mask++)
+            {
+                if (std::popcount(mask) == SUBGRID_SIZE)
+                    this->index[mask] = next++;
+            }
+        }
+    };
+
+    constexpr TripleIndex TRIPLES;
+    constexpr unsigned    TRIPLE_BITS = 7; /**< C(9, 3) = 84 triples fit in 7 bits */
+
+    /**
+     * @brief Key of the last band, given the numbers left in each column
+     *
+     * The count does not change when columns move inside their stack (the first
+     * column stays, since its order is fixed) or when the last two stacks swap, so
+     * the key sorts them first
+     *
+     * @param left Numbers left in each column
+     * @return Key of the last band
+     **/
+    static uint64_t LastBandKey(const uint16_t left[GRID_SIZE])
+    {
+        uint8_t code[GRID_SIZE];
+
+        for (uint16_t col = 0; col < GRID_SIZE; col++)
+        {
+            code[col] = TRIPLES.index[left[col]];
+        }
+
+        std::sort(code + 1, code + SUBGRID_SIZE);
+
+        for (uint16_t stack = 1; stack < SUBGRID_SIZE; stack++)
+        {
+            std::sort(code + stack * SUBGRID_SIZE, code + (stack + 1) * SUBGRID_SIZE);
+        }
+
+        if (std::lexicographical_compare(code + 2 * SUBGRID_SIZE,
+                                         code + GRID_SIZE,
+                                         code + SUBGRID_SIZE,
+                                         code + 2 * SUBGRID_SIZE))
+        {
+            std::swap_ranges(
+                code + SUBGRID_SIZE, code + 2 * SUBGRID_SIZE, code + 2 * SUBGRID_SIZE);
+        }
+
+        uint64_t key = 0;
+
+        for (uint16_t col = 0; col < GRID_SIZE; col++)
+        {
+            key = (key << TRIPLE_BITS) | code[col];
+        }
+
+        return key;
+    }
+
+    /**
+     * @brief Masks of the last band while it is searched
+     */
+    struct LastBand
+    {
+        const uint16_t* left;                  /**< Numbers left in each column */
+        uint16_t        used[GRID_SIZE];       /**< Numbers placed in each column */
+        uint16_t        rows[SUBGRID_SIZE];    /**< Numbers placed in each row */
+        uint16_t        boxes[SUBGRID_SIZE];   /**< Numbers placed in each box */
+        uint64_t        nodes;                 /**< Cells assigned */
+    };
+
+    /**
+     * @brief Count the ways to fill the last band, row-major, its last row being
+     * forced by the columns
+     * @param band Masks of the last band
+     * @param cell Index of the next cell, skipping the first column
+     * @return Number of completions
+     **/
+    static uint64_t FillLastBand(LastBand& band, std::size_t cell)
+    {
+        if (cell == (SUBGRID_SIZE - 1) * BAND_COLS)
+        {
+            const uint16_t lastRow = SUBGRID_SIZE - 1;
+
+            uint16_t row = band.rows[lastRow];
+
+            for (uint16_t col = 1; col < GRID_SIZE; col++)
+            {
+                uint16_t bit = band.left[col] & ~band.used[col];
+
+                if ((row | band.boxes[col / SUBGRID_SIZE]) & bit)
+                    return 0;
+
+                row |= bit;
+            }
+
+            return 1;
+        }
+
+        uint16_t row = cell / BAND_COLS;
+        uint16_t col = 1 + cell % BAND_COLS;
+        uint16_t box = col / SUBGRID_SIZE;
+
+        uint16_t candidates =
+            band.left[col] & ~(band.used[col] | band.rows[row] | band.boxes[box]);
+        uint64_t count = 0;
+
+        while (candidates)
+        {
+            uint16_t bit = candidates & -candidates;
+            candidates ^= bit;
+
+            band.used[col] ^= bit;
+            band.rows[row] ^= bit;
+            band.boxes[box] ^= bit;
+            band.nodes++;
+
+            count += FillLastBand(band, cell + 1);
+
+            band.used[col] ^= bit;
+            band.rows[row] ^= bit;
+            band.boxes[box] ^= bit;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Count the ways to fill the last band
+     * @param left Numbers left in each column
+     * @param nodes Receives the cells assigned
+     * @return Number of completions
+     **/
+    static uint64_t CountLastBand(const uint16_t left[GRID_SIZE], uint64_t& nodes)
+    {
+        LastBand band = { };
+        band.left     = left;
+
+        // Each box must still receive every number
+        for (uint16_t box = 0; box < SUBGRID_SIZE; box++)
+        {
+            uint16_t numbers = 0;
+
+            for (uint16_t i = 0; i < SUBGRID_SIZE; i++)
+            {
+                numbers |= left[box * SUBGRID_SIZE + i];
+            }
+
+            if (numbers != FULL_MASK)
+                return 0;
+        }
+
+        // The first column ascends, so its numbers go down in order
+        uint16_t first = left[0];
+
+        for (uint16_t row = 0; row < SUBGRID_SIZE; row++)
+        {
+            uint16_t bit = first & -first;
+            first ^= bit;
+
+            band.used[0] |= bit;
+            band.rows[row] |= bit;
+            band.boxes[0] |= bit;
+        }
+
+        uint64_t count = FillLastBand(band, 0);
+        nodes += band.nodes;
+
+        return count;
+    }
+
+    /**
+     * @brief Fill the second band, row-major, then count the last band
+     * @param masks Masks of the grid
+     * @param cell Index of the next cell, skipping the first column
+     * @param cache Counts of the last bands already seen
+     * @param accumulator Counters of the calling thread
+     **/
+    static void FillMiddleBand(Masks&       masks,
+                               std::size_t  cell,
+                               BandCache&   cache,
+                               Accumulator& accumulator)
+    {
+        if (cell == BAND_CELLS)
+        {
+            uint16_t left[GRID_SIZE];
+
+            for (uint16_t col = 0; col < GRID_SIZE; col++)
+            {
+                left[col] = FULL_MASK & ~masks.cols[col];
+            }
+
+            uint64_t key = LastBandKey(left);
+            auto     hit = cache.find(key);
+
+            if (hit != cache.end())
+            {
+                accumulator.grids += hit->second;
+                accumulator.cacheHits++;
+                return;
+            }
+
+            uint64_t count = CountLastBand(left, accumulator.nodes);
+
+            if (cache.size() >= MAX_CACHED_BANDS)
+                cache.clear();
+
+            cache.emplace(key, count);
+            accumulator.grids += count;
+
+            return;
+        }
+
+        uint16_t row = SUBGRID_SIZE + cell / BAND_COLS;
+        uint16_t col = 1 + cell % BAND_COLS;
+        uint16_t box = (row / SUBGRID_SIZE) * SUBGRID_SIZE + col / SUBGRID_SIZE;
+
+        uint16_t candidates =
+            FULL_MASK & ~(masks.rows[row] | masks.cols[col] | masks.boxes[box]);
+
+        while (candidates)
+        {
+            uint16_t bit = candidates & -candidates;
+            candidates ^= bit;
+
+            masks.Toggle(row, col, bit);
+            accumulator.nodes++;
+
+            FillMiddleBand(masks, cell + 1, cache, accumulator);
+
+            masks.Toggle(row, col, bit);
+        }
+    }
+
+    void CountCompletions(const Band& band, BandCache& cache, Accumulator& accumulator)
+    {
+        Masks masks = { };
+
+        for (std::size_t cell = 0; cell < band.size(); cell++)
+        {
+            masks.Toggle(cell / GRID_SIZE, cell % GRID_SIZE, 1 << (band[cell] - 1));
+        }
+
+        // The first column below the first band holds the numbers missing from
+        // the first box's column. The second band takes the lowest of them plus
+        // any two others, and both bands ascend. Only the second band is placed
+        // here, the last band follows from what is left
+        uint16_t missing[GRID_SIZE - SUBGRID_SIZE];
+        uint16_t count = 0;
+
+        for (uint16_t num = 1; num <= GRID_SIZE; num++)
+        {
+            if (not(masks.cols[0] & (1 << (num - 1))))
+                missing[count++] = num;
+        }
+
+        for (uint16_t a = 1; a < count; a++)
+        {
+            for (uint16_t b = a + 1; b < count; b++)
+            {
+                uint16_t chosen[SUBGRID_SIZE] = { missing[0], missing[a], missing[b] };
+
+                for (uint16_t i = 0; i < SUBGRID_SIZE; i++)
+                {
+                    masks.Toggle(SUBGRID_SIZE + i, 0, 1 << (chosen[i] - 1));
+                }
+
+                FillMiddleBand(masks, 0, cache, accumulator);
+
+                // Toggling the same cells again clears them
+                for (uint16_t i = 0; i < SUBGRID_SIZE; i++)
+                {
+                    masks.Toggle(SUBGRID_SIZE + i, 0, 1 << (chosen[i] - 1));
+                }
+            }
+        }
+
+        accumulator.bands++;
+    }
+
+    Result Enumerate(const std::vector<Band>& bands, std::size_t threads)
+    {
+        std::vector<Accumulator> accumulators(threads);
+        std::vector<std::thread> workers;
+        std::atomic<std::size_t> next(0);
+
+        auto start = std::chrono::steady_clock::now();
+
+        // Bands differ a lot in cost, so they are handed out one at a time
+        for (std::size_t id = 0; id < threads; id++)
+        {
+            workers.emplace_back(
+                [&bands, &next, &accumulator = accumulators[id], id]()
+                {
+                    BandCache   cache;
+                    std::size_t band;
+
+                    trace::NameThread("enumerate", id);
+
+                    while ((band = next.fetch_add(1, std::memory_order_relaxed)) <
+                           bands.size())
+                    {
+                        trace::Span span("band", "enumerate");
+
+                        span.Argument("band", band);
+                        CountCompletions(bands[band], cache, accumulator);
+                    }
+                });
+        }
+
+        {
+            trace::Span wait("join", "enumerate");
+
+            for (std::thread& worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        Result result = { };
+
+        for (const Accumulator& accumulator : accumulators)
+        {
+            result.grids += accumulator.grids;
+            result.bands += accumulator.bands;
+            result.nodes += accumulator.nodes;
+            result.cacheHits += accumulator.cacheHits;
+        }
+
+        result.seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                .count();
+
+        return result;
+    }
+} // namespace enumeration
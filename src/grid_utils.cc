@@ -6,6 +6,8 @@
 
 #include "grid_utils.h"
 
+#include <cstring>
+
 namespace grid
 {
     bool GridIsValid(uint16_t grid[GRID_SIZE][GRID_SIZE])
@@ -226,4 +228,200 @@ namespace grid
             std::cout << std::endl;
         }
     }
+
+    bool FromGrid(uint16_t        grid[GRID_SIZE][GRID_SIZE],
+                  Board&          board,
+                  const Topology& topology)
+    {
+        bool inRange = true;
+
+        board.Clear();
+
+        for (uint16_t i = 0; i < GRID_SIZE; i++)
+        {
+            for (uint16_t j = 0; j < GRID_SIZE; j++)
+            {
+                if (grid[i][j] == 0)
+                    continue;
+
+                if (grid[i][j] > GRID_SIZE)
+                {
+                    board.cells[i * GRID_SIZE + j] = INVALID_CELL;
+                    inRange                        = false;
+                    continue;
+                }
+
+                board.Set(i, j, grid[i][j], topology);
+            }
+        }
+
+        return inRange;
+    }
+
+    void ToGrid(const Board& board, uint16_t grid[GRID_SIZE][GRID_SIZE])
+    {
+        for (uint16_t i = 0; i < GRID_SIZE; i++)
+        {
+            for (uint16_t j = 0; j < GRID_SIZE; j++)
+            {
+                grid[i][j] = board.Get(i, j);
+            }
+        }
+    }
+
+    bool GridIsValid(const Board& board, const Topology& topology)
+    {
+        // The masks of the board are the union of the numbers in each unit, so they
+        // cannot tell duplicates apart. Rebuild them while looking for collisions
+        uint16_t unitMask[MAX_UNITS] = { };
+        uint8_t  units[MAX_CELL_UNITS];
+
+        for (uint16_t i = 0; i < GRID_SIZE; i++)
+        {
+            for (uint16_t j = 0; j < GRID_SIZE; j++)
+            {
+                uint16_t num = board.Get(i, j);
+
+                if (num == 0)
+                    continue;
+
+                // Case 1: The number is not in the range [1, GRID_SIZE]
+                if (num > GRID_SIZE)
+                {
+                    std::cerr << "Invalid number at position (" << i << ", " << j
+                              << ") = " << num << std::endl;
+
+                    return false;
+                }
+
+                // Case 2: The number already exists in some unit of the cell
+                uint16_t    bit   = 1 << (num - 1);
+                std::size_t count = CellUnits(topology, i * GRID_SIZE + j, units);
+
+                for (std::size_t k = 0; k < count; k++)
+                {
+                    if (unitMask[units[k]] & bit)
+                    {
+                        std::cerr << "Invalid number at position (" << i << ", " << j
+                                  << ") = " << num << std::endl;
+
+                        return false;
+                    }
+
+                    unitMask[units[k]] |= bit;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    bool FindEmptyCell(const Board& board, uint16_t& row, uint16_t& col)
+    {
+        const void* empty = std::memchr(board.cells, 0, BOARD_CELLS);
+
+        if (empty == nullptr)
+        {
+            row = GRID_SIZE;
+            col = 0;
+            return false;
+        }
+
+        std::size_t index = static_cast<const uint8_t*>(empty) - board.cells;
+
+        row = index / GRID_SIZE;
+        col = index % GRID_SIZE;
+
+        return true;
+    }
+
+    void ApplyChanges(Board& board, Vector<State>& state, const Topology& topology)
+    {
+        Pair<uint16_t, uint16_t> position;
+
+        for (std::size_t i = 0; i < state.Size(); i++)
+        {
+            position = state[i].GetFirst();
+
+            board.Set(position.GetFirst(),
+                      position.GetSecond(),
+                      state[i].GetSecond(),
+                      topology);
+        }
+    }
+
+    /**
+     * @brief Get the bit of a number in the masks of a board
+     * @param num Number, from 1 to GRID_SIZE
+     * @return Bit of the number, 0 for any other value so that no mask matches
+     **/
+    static uint16_t NumberBit(uint16_t num)
+    {
+        if (num < 1 or num > GRID_SIZE)
+            return 0;
+
+        return 1 << (num - 1);
+    }
+
+    bool IsInRow(const Board& board, uint16_t row, uint16_t num)
+    {
+        return board.unitMask[ROW_UNITS + row] & NumberBit(num);
+    }
+
+    bool IsInCol(const Board& board, uint16_t col, uint16_t num)
+    {
+        return board.unitMask[COL_UNITS + col] & NumberBit(num);
+    }
+
+    bool IsInBox(const Board&    board,
+                 uint16_t        row,
+                 uint16_t        col,
+                 uint16_t        num,
+                 const Topology& topology)
+    {
+        return board.RegionMask(row, col, topology) & NumberBit(num);
+    }
+
+    bool IsValid(const Board&    board,
+                 uint16_t        row,
+                 uint16_t        col,
+                 uint16_t        num,
+                 const Topology& topology)
+    {
+        return board.Candidates(row, col, topology) & NumberBit(num);
+    }
+
+    void CopyGrid(const Board& source, Board& destination)
+    {
+        destination = source;
+    }
+
+    void PrintGrid(const Board& board)
+    {
+        uint16_t grid[GRID_SIZE][GRID_SIZE];
+
+        ToGrid(board, grid);
+        PrintGrid(grid);
+    }
+
+    void PrintGridPythonStyle(const Board& board)
+    {
+        uint16_t grid[GRID_SIZE][GRID_SIZE];
+
+        ToGrid(board, grid);
+        PrintGridPythonStyle(grid);
+    }
+
+    void PrintSubGrid(const Board& board, uint16_t row, uint16_t col)
+    {
+        uint16_t grid[GRID_SIZE][GRID_SIZE];
+
+        ToGrid(board, grid);
+        PrintSubGrid(grid, row, col);
+    }
+
+    bool IsSolved(const Board& board)
+    {
+        return std::memchr(board.cells, 0, BOARD_CELLS) == nullptr;
+    }
 } // namespace grid
@@ -0,0 +1,404 @@
+/*
+ * Filename: kernels.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "kernels.h"
+
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#    define KERNEL_X86
+#endif
+
+// The bodies are forced inline into each wrapper below, so the compiler generates
+// them again for the instruction set enabled in the wrapper
+#define KERNEL_BODY static inline __attribute__((always_inline))
+
+namespace kernel
+{
+    KERNEL_BODY void ComputeCandidatesBody(const grid::Board&    board,
+                                           const grid::Topology& topology,
+                                           uint16_t candidates[grid::BOARD_CELLS])
+    {
+        for (uint16_t row = 0; row < GRID_SIZE; row++)
+        {
+            uint16_t rowUsed = board.unitMask[grid::ROW_UNITS + row];
+            uint16_t used[GRID_SIZE];
+
+            // Spread the masks of the regions of this row over its columns, so the
+            // inner loop is a straight vectorizable OR
+            for (uint16_t col = 0; col < GRID_SIZE; col++)
+            {
+                used[col] = rowUsed | board.unitMask[grid::COL_UNITS + col] |
+                            board.RegionMask(row, col, topology);
+            }
+
+            for (uint16_t col = 0; col < GRID_SIZE; col++)
+            {
+                std::size_t cell = row * GRID_SIZE + col;
+
+                candidates[cell] =
+                    board.cells[cell] == 0 ? grid::FULL_MASK & ~used[col] : 0;
+            }
+        }
+
+        // Extra units are applied afterwards, so the classic topology skips them
+        for (std::size_t unit = 0; unit < topology.extraCount; unit++)
+        {
+            uint16_t used = board.unitMask[grid::EXTRA_UNITS + unit];
+
+            for (std::size_t i = 0; i < GRID_SIZE; i++)
+            {
+                candidates[topology.extra[unit][i]] &= ~used;
+            }
+        }
+    }
+
+    KERNEL_BODY int PropagateBody(grid::Board& board, const grid::Topology& topology)
+    {
+        uint16_t candidates[grid::BOARD_CELLS];
+        int      filled = 0;
+        bool     changed;
+
+        do
+        {
+            changed = false;
+
+            ComputeCandidatesBody(board, topology, candidates);
+
+            for (uint16_t cell = 0; cell < grid::BOARD_CELLS; cell++)
+            {
+                if (board.cells[cell] != 0)
+                    continue;
+
+                uint16_t row = cell / GRID_SIZE;
+                uint16_t col = cell % GRID_SIZE;
+
+                // Cells filled earlier in this pass may have removed candidates
+                uint16_t mask = candidates[cell] & board.Candidates(row, col, topology);
+
+                if (mask == 0)
+                    return -1;
+
+                if (std::has_single_bit(mask))
+                {
+                    board.Set(row, col, std::countr_zero(mask) + 1, topology);
+                    filled++;
+                    changed = true;
+                }
+            }
+        } while (changed);
+
+        return filled;
+    }
+
+    /**
+     * @brief Check the masks of the units of a grid given as one bit per cell
+     *
+     * The sum of the bits of a unit equals their OR exactly when no bit repeats, so
+     * both reductions vectorize without any popcount
+     *
+     * @param bits Bit of the number of each cell, 0 for empty cells
+     * @param topology Topology of the grid
+     * @param solutions If true, every unit must hold every number
+     * @return True if no unit repeats a number (and all are full, for solutions)
+     **/
+    KERNEL_BODY bool CheckUnitsBody(const uint16_t        bits[grid::BOARD_CELLS],
+                                    const grid::Topology& topology,
+                                    bool                  solutions)
+    {
+        uint16_t unitOr[grid::MAX_UNITS]  = { };
+        uint16_t unitSum[grid::MAX_UNITS] = { };
+
+        for (uint16_t row = 0; row < GRID_SIZE; row++)
+        {
+            for (uint16_t col = 0; col < GRID_SIZE; col++)
+            {
+                std::size_t cell   = row * GRID_SIZE + col;
+                uint16_t    bit    = bits[cell];
+                std::size_t region = grid::REGION_UNITS + topology.region[cell];
+
+                unitOr[grid::ROW_UNITS + row] |= bit;
+                unitSum[grid::ROW_UNITS + row] += bit;
+                unitOr[grid::COL_UNITS + col] |= bit;
+                unitSum[grid::COL_UNITS + col] += bit;
+                unitOr[region] |= bit;
+                unitSum[region] += bit;
+            }
+        }
+
+        for (std::size_t unit = 0; unit < topology.extraCount; unit++)
+        {
+            for (std::size_t i = 0; i < GRID_SIZE; i++)
+            {
+                uint16_t bit = bits[topology.extra[unit][i]];
+
+                unitOr[grid::EXTRA_UNITS + unit] |= bit;
+                unitSum[grid::EXTRA_UNITS + unit] += bit;
+            }
+        }
+
+        uint16_t repeated   = 0;
+        uint16_t incomplete = 0;
+
+        for (std::size_t unit = 0; unit < topology.Units(); unit++)
+        {
+            repeated |= unitOr[unit] ^ unitSum[unit];
+            incomplete |= unitOr[unit] ^ grid::FULL_MASK;
+        }
+
+        return not repeated and (not solutions or not incomplete);
+    }
+
+    KERNEL_BODY bool ValidateBody(const grid::Board&    board,
+                                  const grid::Topology& topology)
+    {
+        uint16_t bits[grid::BOARD_CELLS];
+        uint8_t  outOfRange = 0;
+
+        for (std::size_t cell = 0; cell < grid::BOARD_CELLS; cell++)
+        {
+            uint8_t num = board.cells[cell];
+
+            outOfRange |= num > GRID_SIZE;
+            bits[cell] = (num - 1u) < GRID_SIZE ? 1u << (num - 1) : 0;
+        }
+
+        return not outOfRange and CheckUnitsBody(bits, topology, false);
+    }
+
+    /**
+     * @brief Check a block of LANES interleaved grids at once, one grid per lane
+     *
+     * A cell of the block holds that cell of every grid in consecutive bytes, so
+     * each step loads the cell of all the grids together and folds it into the
+     * masks of its units, which hold one entry per grid. Every step applies the
+     * same operation to all lanes, so the inner loops become SIMD instructions
+     * that check LANES grids together instead of one unit at a time
+     *
+     * @param block Interleaved grids, LANES of them
+     * @param solutions If true, every unit must hold every number
+     * @param topology Topology of the grids
+     * @param valid Receives 1 for each valid grid and 0 otherwise
+     **/
+    KERNEL_BODY void ValidateBlockBody(const uint8_t*        block,
+                                       bool                  solutions,
+                                       const grid::Topology& topology,
+                                       uint8_t*              valid)
+    {
+        uint16_t unitOr[grid::MAX_UNITS][LANES]  = { };
+        uint16_t unitSum[grid::MAX_UNITS][LANES] = { };
+        uint8_t  outOfRange[LANES]               = { };
+
+        for (std::size_t cell = 0; cell < grid::BOARD_CELLS; cell++)
+        {
+            const uint8_t* nums = block + cell * LANES;
+            uint16_t       bits[LANES];
+
+            // One bit per number. Out of range values (including BAD_CELL) are
+            // flagged and mapped to an empty cell
+            for (std::size_t lane = 0; lane < LANES; lane++)
+            {
+                outOfRange[lane] |= nums[lane] > GRID_SIZE;
+                bits[lane] = (nums[lane] - 1u) < GRID_SIZE ? 1u << (nums[lane] - 1) : 0;
+            }
+
+            uint8_t     units[grid::MAX_CELL_UNITS];
+            std::size_t unitCount = grid::CellUnits(topology, cell, units);
+
+            // The sum of the bits of a unit equals their OR when no bit repeats
+            for (std::size_t i = 0; i < unitCount; i++)
+            {
+                uint16_t* unitOrs  = unitOr[units[i]];
+                uint16_t* unitSums = unitSum[units[i]];
+
+                for (std::size_t lane = 0; lane < LANES; lane++)
+                {
+                    unitOrs[lane] |= bits[lane];
+                    unitSums[lane] += bits[lane];
+                }
+            }
+        }
+
+        uint16_t repeated[LANES]   = { };
+        uint16_t incomplete[LANES] = { };
+
+        for (std::size_t unit = 0; unit < topology.Units(); unit++)
+        {
+            for (std::size_t lane = 0; lane < LANES; lane++)
+            {
+                repeated[lane] |= unitOr[unit][lane] ^ unitSum[unit][lane];
+                incomplete[lane] |= unitOr[unit][lane] ^ grid::FULL_MASK;
+            }
+        }
+
+        for (std::size_t lane = 0; lane < LANES; lane++)
+        {
+            valid[lane] = not outOfRange[lane] and not repeated[lane] and
+                          (not solutions or not incomplete[lane]);
+        }
+    }
+
+    KERNEL_BODY void ValidateManyBody(const uint8_t*        cells,
+                                      std::size_t           blocks,
+                                      bool                  solutions,
+                                      const grid::Topology& topology,
+                                      uint8_t*              valid)
+    {
+        for (std::size_t block = 0; block < blocks; block++)
+        {
+            ValidateBlockBody(cells + block * LANES * grid::BOARD_CELLS,
+                              solutions,
+                              topology,
+                              valid + block * LANES);
+        }
+    }
+
+    KERNEL_BODY bool
+    ParseBody(const char* text, const grid::Topology& topology, grid::Board& board)
+    {
+        uint8_t bad = 0;
+
+        board.Clear();
+
+        // Branch-free digit conversion over the whole board, '.' maps to 0
+        for (std::size_t cell = 0; cell < grid::BOARD_CELLS; cell++)
+        {
+            uint8_t c     = text[cell];
+            uint8_t digit = c - '0';
+            uint8_t dot   = c == '.';
+
+            bad |= (digit > GRID_SIZE) & not dot;
+            board.cells[cell] = dot ? 0 : digit;
+        }
+
+        if (bad)
+            return false;
+
+        for (uint16_t row = 0; row < GRID_SIZE; row++)
+        {
+            for (uint16_t col = 0; col < GRID_SIZE; col++)
+            {
+                uint16_t num = board.Get(row, col);
+
+                if (num != 0)
+                    board.Set(row, col, num, topology);
+            }
+        }
+
+        return true;
+    }
+
+// Defines the kernel table for one instruction set. An empty target compiles for
+// the baseline of the build
+#define KERNEL_VARIANT(SUFFIX, TARGET)                                                 \
+    TARGET static int Propagate##SUFFIX(grid::Board&          board,                   \
+                                        const grid::Topology& topology)                \
+    {                                                                                  \
+        return PropagateBody(board, topology);                                         \
+    }                                                                                  \
+                                                                                       \
+    TARGET static bool Validate##SUFFIX(const grid::Board&    board,                   \
+                                        const grid::Topology& topology)                \
+    {                                                                                  \
+        return ValidateBody(board, topology);                                          \
+    }                                                                                  \
+                                                                                       \
+    TARGET static void ValidateMany##SUFFIX(const uint8_t*        cells,               \
+                                            std::size_t           blocks,              \
+                                            bool                  solutions,           \
+                                            const grid::Topology& topology,            \
+                                            uint8_t*              valid)               \
+    {                                                                                  \
+        ValidateManyBody(cells, blocks, solutions, topology, valid);                   \
+    }                                                                                  \
+                                                                                       \
+    TARGET static bool Parse##SUFFIX(const char*           text,                       \
+                                     const grid::Topology& topology,                   \
+                                     grid::Board&          board)                      \
+    {                                                                                  \
+        return ParseBody(text, topology, board);                                       \
+    }
+
+    KERNEL_VARIANT(Generic, )
+
+#ifdef KERNEL_X86
+    KERNEL_VARIANT(SSE42, __attribute__((target("sse4.2,popcnt"))))
+    KERNEL_VARIANT(AVX2, __attribute__((target("avx2,bmi,bmi2,popcnt"))))
+    KERNEL_VARIANT(AVX512,
+                   __attribute__((target("avx512f,avx512bw,avx512vl,bmi,bmi2,popcnt"))))
+#endif
+
+    static const Kernels GENERIC = {
+        "generic",           PropagateGeneric,   ValidateGeneric,
+        ValidateManyGeneric, ParseGeneric,
+    };
+
+#ifdef KERNEL_X86
+    static const Kernels SSE42 = {
+        "sse4.2",          PropagateSSE42, ValidateSSE42,
+        ValidateManySSE42, ParseSSE42,
+    };
+
+    static const Kernels AVX2 = {
+        "avx2",           PropagateAVX2, ValidateAVX2,
+        ValidateManyAVX2, ParseAVX2,
+    };
+
+    static const Kernels AVX512 = {
+        "avx512",           PropagateAVX512, ValidateAVX512,
+        ValidateManyAVX512, ParseAVX512,
+    };
+#endif
+
+    /**
+     * @brief Pick the best table supported by the host, never above the one named
+     * by SUDOKU_KERNEL
+     * @return Table of kernels
+     **/
+    static const Kernels& Resolve()
+    {
+        const Kernels* best = &GENERIC;
+
+#ifdef KERNEL_X86
+        __builtin_cpu_init();
+
+        const char* requested = std::getenv("SUDOKU_KERNEL");
+
+        const Kernels* candidates[] = { &AVX512, &AVX2, &SSE42 };
+        bool           supported[]  = {
+            __builtin_cpu_supports("avx512f") and __builtin_cpu_supports("avx512bw") and
+                __builtin_cpu_supports("avx512vl") and __builtin_cpu_supports("bmi2"),
+            __builtin_cpu_supports("avx2") and __builtin_cpu_supports("bmi2"),
+            __builtin_cpu_supports("sse4.2") and __builtin_cpu_supports("popcnt"),
+        };
+
+        bool allowed = requested == nullptr;
+
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            allowed |= requested != nullptr and
+                       std::strcmp(requested, candidates[i]->name) == 0;
+
+            if (allowed and supported[i])
+            {
+                best = candidates[i];
+                break;
+            }
+        }
+#endif
+
+        return *best;
+    }
+
+    const Kernels& Active()
+    {
+        static const Kernels& active = Resolve();
+
+        return active;
+    }
+} // namespace kernel
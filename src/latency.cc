@@ -0,0 +1,96 @@
+/*
+ * Filename: latency.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "latency.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+
+namespace latency
+{
+    Histogram::Histogram()
+        : m_counts(BUCKETS, 0),
+          m_total(0),
+          m_max(0),
+          m_sum(0)
+    { }
+
+    uint64_t Histogram::Highest(std::size_t bucket)
+    {
+        if (bucket < SUB_BUCKETS)
+            return bucket;
+
+        std::size_t shift = (bucket - SUB_BUCKETS) / HALF + 1;
+        uint64_t    top   = (bucket - SUB_BUCKETS) % HALF + HALF;
+
+        return ((top + 1) << shift) - 1;
+    }
+
+    void Histogram::Merge(const Histogram& other)
+    {
+        for (std::size_t bucket = 0; bucket < BUCKETS; bucket++)
+        {
+            this->m_counts[bucket] += other.m_counts[bucket];
+        }
+
+        this->m_total += other.m_total;
+        this->m_sum += other.m_sum;
+        this->m_max = std::max(this->m_max, other.m_max);
+    }
+
+    uint64_t Histogram::Percentile(double percentile) const
+    {
+        if (this->m_total == 0)
+            return 0;
+
+        // Nearest rank, as in bench::Summarize
+        double   exact = std::ceil(percentile / 100 * this->m_total);
+        uint64_t rank  = std::clamp<uint64_t>(exact, 1, this->m_total);
+        uint64_t seen  = 0;
+
+        for (std::size_t bucket = 0; bucket < BUCKETS; bucket++)
+        {
+            seen += this->m_counts[bucket];
+
+            if (seen >= rank)
+                return std::min(Highest(bucket), this->m_max);
+        }
+
+        return this->m_max;
+    }
+
+    Percentiles Histogram::Summary() const
+    {
+        Percentiles summary;
+
+        summary.count = this->m_total;
+        summary.p50   = this->Percentile(50);
+        summary.p90   = this->Percentile(90);
+        summary.p99   = this->Percentile(99);
+        summary.p999  = this->Percentile(99.9);
+        summary.max   = this->m_max;
+        summary.mean  = this->m_total == 0 ? 0 : this->m_sum / this->m_total;
+
+        return summary;
+    }
+
+    void WriteJson(std::FILE* file, const Percentiles& summary)
+    {
+        std::fprintf(file,
+                     "{ \"count\": %" PRIu64 ", \"p50_ns\": %" PRIu64
+                     ", \"p90_ns\": %" PRIu64 ", \"p99_ns\": %" PRIu64
+                     ", \"p999_ns\": %" PRIu64 ", \"max_ns\": %" PRIu64
+                     ", \"mean_ns\": %.0f }",
+                     summary.count,
+                     summary.p50,
+                     summary.p90,
+                     summary.p99,
+                     summary.p999,
+                     summary.max,
+                     summary.mean);
+    }
+} // namespace latency
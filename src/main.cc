@@ -9,9 +9,16 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <vector>
 
+#include "commands.h"
 #include "constants.h"
+#include "kernels.h"
+#include "output.h"
 #include "solver.h"
+#include "time_series.h"
+#include "trace.h"
 
 void HelpMessage(int argc, char* argv[])
 {
@@ -25,44 +32,300 @@ void HelpMessage(int argc, char* argv[])
     }
     std::cerr << std::endl;
 
-    std::cerr << "Expected input: " << argv[0] << " <algorithm> <grid>" << std::endl;
+    std::cerr << "Expected input: " << argv[0] << " [options] <algorithm> <grid>"
+              << std::endl;
+    std::cerr << "Or: " << argv[0] << " [options] --input=<file> <algorithm>"
+              << std::endl;
     std::cerr << "Where <algorithm> is one of the following:" << std::endl;
     std::cerr << "\t- 'B' for Breadth-First Search" << std::endl;
     std::cerr << "\t- 'I' for Iterative Deepening Depth-First Search" << std::endl;
     std::cerr << "\t- 'A' for A* Search" << std::endl;
     std::cerr << "\t- 'U' for Uniform Cost Search" << std::endl;
     std::cerr << "\t- 'G' for Greedy Best-First Search" << std::endl;
+    std::cerr << "\t- 'L' for local search (simulated annealing)" << std::endl;
+    std::cerr << "\t- 'P' for parallel Depth-First Search" << std::endl;
     std::cerr << "And <grid> is a " << GRID_SIZE << "x" << GRID_SIZE
               << " matrix representing the Sudoku board" << std::endl;
     std::cerr << "Each cell must be a digit from 0 to " << GRID_SIZE
               << ", where 0 represents an empty cell" << std::endl;
+    std::cerr << "Or: " << argv[0]
+              << " validate [--solutions] [--variant=<name>] <file>..." << std::endl;
+    std::cerr << "Or: " << argv[0] << " enumerate [--bands=<n>] [--threads=<n>]"
+              << std::endl;
+    std::cerr << "Or: " << argv[0] << " anneal [--iterations=<n>] [--seed=<n>] <file>"
+              << std::endl;
+    std::cerr << "Or: " << argv[0] << " replay <log>" << std::endl;
+    std::cerr << "Options:" << std::endl;
+    std::cerr << "\t--propagate       fill single-candidate cells after each move"
+              << std::endl;
+    std::cerr << "\t--variant=<name>  classic, diagonal, windoku or jigsaw:<regions>,"
+              << std::endl;
+    std::cerr << "\t                  where <regions> gives the region (1 to "
+              << GRID_SIZE << ") of each cell" << std::endl;
+    std::cerr << "\t--iterations=<n>  move budget of the local search" << std::endl;
+    std::cerr << "\t--threads=<n>     workers of the parallel search" << std::endl;
+    std::cerr << "\t--deterministic   parallel results independent of the threads"
+              << std::endl;
+    std::cerr << "\t--seed=<n>        seed of the step costs and of the local search"
+              << std::endl;
+    std::cerr << "\t--record=<file>   log the decisions of a tree search, for replay"
+              << std::endl;
+    std::cerr << "\t--histograms      nodes, branching and dead ends per depth"
+              << std::endl;
+    std::cerr << "\t--memory          peak bytes of each structure of the search"
+              << std::endl;
+    std::cerr << "\t--perf-counters   L1d read misses per expansion, with perf_event"
+              << std::endl;
+    std::cerr << "\t--heartbeat=<n>[ms] report the progress every n seconds, or n ms"
+              << std::endl;
+    std::cerr << "\t--status-file=<f> write the report to a file instead of stderr"
+              << std::endl;
+    std::cerr << "\t--series=<n>[ms]  sample the frontier and the node store every n"
+              << std::endl;
+    std::cerr << "\t                  expansions, or every n ms" << std::endl;
+    std::cerr << "\t--series-file=<f> write the samples as CSV, or JSON for *.json"
+              << std::endl;
+    std::cerr << "\t--trace=<file>    write a Chrome trace of the run (any subcommand)"
+              << std::endl;
+    std::cerr << "\t--format=<name>   text, json, csv or compact, one record per puzzle"
+              << std::endl;
+    std::cerr << "\t--input=<file>    solve each line of a file ('-' for stdin) instead"
+              << std::endl;
+    std::cerr << "\t                  of <grid>" << std::endl;
     std::cerr << "Example: " << argv[0]
               << " B 800000000 003600000 070090200 050007000 000045700 000100030 "
                  "001000068 008500010 090000400"
               << std::endl;
 }
 
+/**
+ * @brief Parse an option given as --name
+ * @param option Option to parse
+ * @param options Options of the solver that receive the parsed value
+ * @return True if the option is known, false otherwise
+ **/
+bool ParseOption(const char* option, sudoku::SolverOptions& options)
+{
+    // Jigsaw tables are built at load time and must outlive the solver
+    static grid::Topology custom;
+
+    if (std::strcmp(option, "--propagate") == 0)
+    {
+        options.propagate = true;
+        return true;
+    }
+
+    if (std::strncmp(option, "--variant=", 10) == 0)
+    {
+        options.topology = grid::FindTopology(option + 10, custom);
+        return options.topology != nullptr;
+    }
+
+    if (std::strncmp(option, "--iterations=", 13) == 0)
+    {
+        char* end;
+
+        options.iterations = std::strtoull(option + 13, &end, 10);
+        return *end == '\0' and end != option + 13;
+    }
+
+    if (std::strncmp(option, "--threads=", 10) == 0)
+    {
+        char* end;
+
+        options.threads = std::strtoull(option + 10, &end, 10);
+        return *end == '\0' and end != option + 10 and options.threads > 0;
+    }
+
+    if (std::strcmp(option, "--deterministic") == 0)
+    {
+        options.deterministic = true;
+        return true;
+    }
+
+    if (std::strncmp(option, "--seed=", 7) == 0)
+    {
+        char* end;
+
+        options.seed = std::strtoull(option + 7, &end, 10);
+        return *end == '\0' and end != option + 7;
+    }
+
+    if (std::strncmp(option, "--record=", 9) == 0)
+    {
+        options.record = option + 9;
+        return *options.record != '\0';
+    }
+
+    if (std::strcmp(option, "--perf-counters") == 0)
+    {
+        options.perfCounters = true;
+        return true;
+    }
+
+    if (std::strcmp(option, "--histograms") == 0)
+    {
+        options.histograms = true;
+        return true;
+    }
+
+    if (std::strcmp(option, "--memory") == 0)
+    {
+        options.memory = true;
+        return true;
+    }
+
+    if (std::strncmp(option, "--heartbeat=", 12) == 0)
+        return progress::ParsePeriod(option + 12, options.heartbeat);
+
+    if (std::strncmp(option, "--status-file=", 14) == 0)
+    {
+        options.heartbeat.statusFile = option + 14;
+        return *options.heartbeat.statusFile != '\0';
+    }
+
+    if (std::strncmp(option, "--series=", 9) == 0)
+        return series::ParseInterval(option + 9, options.series);
+
+    if (std::strncmp(option, "--series-file=", 14) == 0)
+    {
+        options.seriesFile = option + 14;
+        return *options.seriesFile != '\0';
+    }
+
+    return false;
+}
+
+/**
+ * @brief Remove the --trace=<file> option from the arguments
+ *
+ * Tracing applies to every subcommand, so the option is taken out before they
+ * parse their own arguments
+ *
+ * @param argc Number of arguments, decremented if the option is found
+ * @param argv Arguments
+ * @return File of the trace, or nullptr if the option is absent
+ **/
+const char* TakeTraceOption(int& argc, char* argv[])
+{
+    const char* path = nullptr;
+    int         kept = 0;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if (std::strncmp(argv[i], "--trace=", 8) == 0 and argv[i][8] != '\0')
+            path = argv[i] + 8;
+        else
+            argv[kept++] = argv[i];
+    }
+
+    argc = kept;
+
+    return path;
+}
+
 int main(int argc, char* argv[])
 {
-    uint16_t grid[GRID_SIZE][GRID_SIZE];
+    uint16_t              grid[GRID_SIZE][GRID_SIZE];
+    sudoku::SolverOptions options;
+    std::vector<char*>    args;
+    output::Format        format = output::Format::TEXT;
+    const char*           input  = nullptr;
+
+    // Written when main returns, after every worker thread has been joined
+    trace::Session tracing(TakeTraceOption(argc, argv));
+
+    if (argc > 1 and std::strcmp(argv[1], "validate") == 0)
+        return command::Validate(argc - 2, argv + 2);
+
+    if (argc > 1 and std::strcmp(argv[1], "enumerate") == 0)
+        return command::Enumerate(argc - 2, argv + 2);
+
+    if (argc > 1 and std::strcmp(argv[1], "anneal") == 0)
+        return command::Anneal(argc - 2, argv + 2);
+
+    if (argc > 1 and std::strcmp(argv[1], "replay") == 0)
+        return command::Replay(argc - 2, argv + 2);
+
+    // Options may appear anywhere, everything else is positional
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strncmp(argv[i], "--", 2) != 0)
+        {
+            args.push_back(argv[i]);
+        }
+        else if (std::strncmp(argv[i], "--input=", 8) == 0)
+        {
+            input = argv[i] + 8;
+        }
+        else if (std::strncmp(argv[i], "--format=", 9) == 0)
+        {
+            if (not output::ParseFormat(argv[i] + 9, format))
+            {
+                HelpMessage(argc, argv);
+                return EXIT_FAILURE;
+            }
+        }
+        else if (not ParseOption(argv[i], options))
+        {
+            HelpMessage(argc, argv);
+            return EXIT_FAILURE;
+        }
+    }
 
-    if (argc != GRID_SIZE + 2)
+    // The puzzles come from a file, so only the algorithm is positional
+    if (input != nullptr and args.size() == 1)
+    {
+        return command::SolveFile(
+            input, static_cast<Algorithm>(args[0][0]), options, format);
+    }
+
+    if (args.size() != GRID_SIZE + 1)
     {
         HelpMessage(argc, argv);
         return EXIT_FAILURE;
     }
 
-    char algorithm = argv[1][0];
+    char algorithm = args[0][0];
+
+    // Join the rows, so the whole grid is parsed by a single kernel call
+    char text[grid::BOARD_CELLS];
 
-    for (int i = 2; i < argc; i++)
+    for (std::size_t i = 0; i < GRID_SIZE; i++)
     {
-        for (std::size_t j = 0; j < GRID_SIZE; j++)
+        if (std::strlen(args[i + 1]) != GRID_SIZE)
         {
-            grid[i - 2][j] = argv[i][j] - '0';
+            HelpMessage(argc, argv);
+            return EXIT_FAILURE;
         }
+
+        std::memcpy(text + i * GRID_SIZE, args[i + 1], GRID_SIZE);
+    }
+
+    grid::Board board;
+    bool        parsed;
+
+    {
+        trace::Span span("parse", "input");
+        parsed = kernel::Active().parse(text, *options.topology, board);
+    }
+
+    if (not parsed)
+    {
+        HelpMessage(argc, argv);
+        return EXIT_FAILURE;
+    }
+
+    grid::ToGrid(board, grid);
+
+    if (format != output::Format::TEXT)
+    {
+        command::WriteSolution(
+            grid, static_cast<Algorithm>(algorithm), options, format);
+        return EXIT_SUCCESS;
     }
 
-    sudoku::Solver solver(grid, static_cast<Algorithm>(algorithm));
+    sudoku::Solver solver(grid, static_cast<Algorithm>(algorithm), options);
     solver.Solve();
 
     return EXIT_SUCCESS;
@@ -0,0 +1,116 @@
+/*
+ * Filename: memory_usage.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "memory_usage.h"
+
+#include <cstdio>
+#include <sys/resource.h>
+
+namespace memory
+{
+    uint64_t Usage::Total() const
+    {
+        uint64_t total = 0;
+
+        for (std::size_t component = 0; component < COMPONENTS; component++)
+        {
+            total += this->bytes[component];
+        }
+
+        return total;
+    }
+
+    uint64_t Usage::Reserved() const
+    {
+        uint64_t total = 0;
+
+        for (std::size_t component = 0; component < COMPONENTS; component++)
+        {
+            total += this->reserved[component];
+        }
+
+        return total;
+    }
+
+    double Usage::BytesPerFrontierNode() const
+    {
+        return this->frontier == 0
+                   ? 0.0
+                   : static_cast<double>(this->Total()) / this->frontier;
+    }
+
+    const char* ComponentName(Component component)
+    {
+        switch (component)
+        {
+            case NODES:
+                return "nodes";
+            case BOARDS:
+                return "boards";
+            case FREE_LIST:
+                return "free list";
+            case FRONTIER:
+                return "frontier";
+            case CHILDREN:
+                return "children";
+            default:
+                return "unknown";
+        }
+    }
+
+    uint64_t PeakRss()
+    {
+        struct rusage usage;
+
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return 0;
+
+        return usage.ru_maxrss;
+    }
+
+    void Print(const Usage& usage)
+    {
+        uint64_t total = usage.Total();
+
+        std::printf(
+            "%-12s %14s %8s %14s\n", "component", "peak bytes", "share", "reserved");
+
+        for (std::size_t component = 0; component < COMPONENTS; component++)
+        {
+            std::printf("%-12s %14llu %7.1f%% %14llu\n",
+                        ComponentName(static_cast<Component>(component)),
+                        static_cast<unsigned long long>(usage.bytes[component]),
+                        total == 0 ? 0.0 : 100.0 * usage.bytes[component] / total,
+                        static_cast<unsigned long long>(usage.reserved[component]));
+        }
+
+        std::printf("%-12s %14llu %8s %14llu\n",
+                    "total",
+                    static_cast<unsigned long long>(total),
+                    "",
+                    static_cast<unsigned long long>(usage.Reserved()));
+
+        if (usage.frontier > 0)
+            std::printf("Bytes per frontier node: %.1f (largest frontier: %llu)\n",
+                        usage.BytesPerFrontierNode(),
+                        static_cast<unsigned long long>(usage.frontier));
+
+        // ru_maxrss only moves when the search goes past the earlier peak of the
+        // process, so a search smaller than a previous one shows no growth
+        uint64_t growth = usage.rssAfter - usage.rssBefore;
+
+        std::printf("Peak RSS: %llu KiB, %llu KiB above the start of the search",
+                    static_cast<unsigned long long>(usage.rssAfter),
+                    static_cast<unsigned long long>(growth));
+
+        if (growth > 0)
+            std::printf(" (%.1f%% accounted)", 100.0 * total / (growth * 1024.0));
+        else
+            std::printf(" (peak reached before the search)");
+
+        std::printf("\n");
+    }
+} // namespace memory
@@ -0,0 +1,273 @@
+/*
+ * Filename: output.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "output.h"
+
+#include <cstring>
+#include <iterator>
+
+#include "trace.h"
+
+namespace output
+{
+    bool ParseFormat(const char* name, Format& format)
+    {
+        if (std::strcmp(name, "text") == 0)
+            format = Format::TEXT;
+        else if (std::strcmp(name, "json") == 0)
+            format = Format::JSON;
+        else if (std::strcmp(name, "csv") == 0)
+            format = Format::CSV;
+        else if (std::strcmp(name, "compact") == 0)
+            format = Format::COMPACT;
+        else
+            return false;
+
+        return true;
+    }
+
+    const char* StatusName(Status status)
+    {
+        switch (status)
+        {
+            case Status::SOLVED:
+                return "solved";
+            case Status::UNSOLVED:
+                return "unsolved";
+            case Status::INVALID:
+                return "invalid";
+            case Status::MALFORMED:
+                return "malformed";
+            default:
+                return "unknown";
+        }
+    }
+
+    Writer::Writer(std::FILE* file)
+        : m_file(file),
+          m_used(0)
+    { }
+
+    Writer::~Writer()
+    {
+        this->Flush();
+    }
+
+    void Writer::Write(const char* text, std::size_t length)
+    {
+        if (this->m_used + length > BUFFER_SIZE)
+        {
+            this->Flush();
+
+            // Too large to be worth buffering
+            if (length > BUFFER_SIZE)
+            {
+                std::fwrite(text, 1, length, this->m_file);
+                return;
+            }
+        }
+
+        std::memcpy(this->m_buffer + this->m_used, text, length);
+        this->m_used += length;
+    }
+
+    void Writer::Write(const char* text)
+    {
+        this->Write(text, std::strlen(text));
+    }
+
+    void Writer::Write(char c)
+    {
+        if (this->m_used == BUFFER_SIZE)
+            this->Flush();
+
+        this->m_buffer[this->m_used++] = c;
+    }
+
+    void Writer::WriteNumber(uint64_t value)
+    {
+        char        digits[20];
+        std::size_t count = sizeof(digits);
+
+        do
+        {
+            digits[--count] = '0' + value % 10;
+            value /= 10;
+        } while (value != 0);
+
+        this->Write(digits + count, sizeof(digits) - count);
+    }
+
+    void Writer::Flush()
+    {
+        trace::Span span("flush", "output");
+
+        span.Argument("bytes", this->m_used);
+
+        if (this->m_used > 0)
+            std::fwrite(this->m_buffer, 1, this->m_used, this->m_file);
+
+        this->m_used = 0;
+    }
+
+    void WriteHeader(Writer& writer, Format format)
+    {
+        if (format == Format::CSV)
+        {
+            writer.Write("index,status,algorithm,solution,search_ns,total_ns,expanded,"
+                         "generated,propagated,moves,process_peak_kib\n");
+        }
+    }
+
+    /**
+     * @brief Write the cells of a board as GRID_SIZE * GRID_SIZE digits
+     * @param writer Destination
+     * @param board Board to write
+     **/
+    static void WriteCells(Writer& writer, const grid::Board& board)
+    {
+        char text[grid::BOARD_CELLS];
+
+        for (std::size_t cell = 0; cell < grid::BOARD_CELLS; cell++)
+        {
+            text[cell] = '0' + board.cells[cell];
+        }
+
+        writer.Write(text, grid::BOARD_CELLS);
+    }
+
+    void WriteRecord(Writer& writer, Format format, const Record& record)
+    {
+        const uint64_t numbers[] = { record.searchNs,   record.totalNs,
+                                     record.expanded,   record.generated,
+                                     record.propagated, record.moves,
+                                     record.processPeak };
+
+        if (format == Format::JSON)
+        {
+            constexpr const char* NAMES[] = { "search_ns",  "total_ns",
+                                              "expanded",   "generated",
+                                              "propagated", "moves",
+                                              "process_peak_kib" };
+
+            writer.Write("{\"index\":");
+            writer.WriteNumber(record.index);
+            writer.Write(",\"status\":\"");
+            writer.Write(StatusName(record.status));
+            writer.Write("\",\"algorithm\":\"");
+            writer.Write(record.algorithm);
+            writer.Write("\",\"solution\":");
+
+            if (record.solution != nullptr)
+            {
+                writer.Write('"');
+                WriteCells(writer, *record.solution);
+                writer.Write('"');
+            }
+            else
+            {
+                writer.Write("null");
+            }
+
+            for (std::size_t i = 0; i < std::size(numbers); i++)
+            {
+                writer.Write(",\"");
+                writer.Write(NAMES[i]);
+                writer.Write("\":");
+                writer.WriteNumber(numbers[i]);
+            }
+
+            if (record.phases != nullptr)
+            {
+                writer.Write(",\"phases\":{");
+
+                for (std::size_t i = 0; i < phase::PHASES; i++)
+                {
+                    const char* name = phase::PhaseName(static_cast<phase::Phase>(i));
+
+                    writer.Write(i == 0 ? "\"" : ",\"");
+                    writer.Write(name);
+                    writer.Write("_ns\":");
+                    writer.WriteNumber(record.phases->nanoseconds[i]);
+                    writer.Write(",\"");
+                    writer.Write(name);
+                    writer.Write("_calls\":");
+                    writer.WriteNumber(record.phases->calls[i]);
+                }
+
+                writer.Write('}');
+            }
+
+            if (record.memory != nullptr)
+            {
+                writer.Write(",\"memory\":{");
+
+                for (std::size_t i = 0; i < memory::COMPONENTS; i++)
+                {
+                    const char* name =
+                        memory::ComponentName(static_cast<memory::Component>(i));
+
+                    writer.Write(i == 0 ? "\"" : ",\"");
+
+                    // "free list" becomes free_list
+                    for (const char* c = name; *c != '\0'; c++)
+                    {
+                        writer.Write(*c == ' ' ? '_' : *c);
+                    }
+
+                    writer.Write("_bytes\":");
+                    writer.WriteNumber(record.memory->bytes[i]);
+                }
+
+                writer.Write(",\"total_bytes\":");
+                writer.WriteNumber(record.memory->Total());
+                writer.Write(",\"frontier_peak\":");
+                writer.WriteNumber(record.memory->frontier);
+                writer.Write('}');
+            }
+
+            writer.Write("}\n");
+            return;
+        }
+
+        // CSV and compact only differ in the separator. A missing solution is
+        // left empty in CSV and written as '-' in compact, so fields never vanish
+        char separator = format == Format::CSV ? ',' : ' ';
+
+        writer.WriteNumber(record.index);
+        writer.Write(separator);
+        writer.Write(StatusName(record.status));
+        writer.Write(separator);
+
+        if (format == Format::CSV)
+        {
+            writer.Write(record.algorithm);
+        }
+        else
+        {
+            // Names such as "PARALLEL DFS" would add a field
+            for (const char* c = record.algorithm; *c != '\0'; c++)
+            {
+                writer.Write(*c == ' ' ? '-' : *c);
+            }
+        }
+
+        writer.Write(separator);
+
+        if (record.solution != nullptr)
+            WriteCells(writer, *record.solution);
+        else if (format == Format::COMPACT)
+            writer.Write('-');
+
+        for (uint64_t number : numbers)
+        {
+            writer.Write(separator);
+            writer.WriteNumber(number);
+        }
+
+        writer.Write('\n');
+    }
+} // namespace output
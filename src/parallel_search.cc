@@ -0,0 +1,332 @@
+/*
+ * Filename: parallel_search.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "parallel_search.h"
+
+#include <algorithm>
+#include <sched.h>
+#include <thread>
+
+#include "grid_utils.h"
+#include "kernels.h"
+#include "probes.h"
+#include "trace.h"
+
+namespace sudoku
+{
+    ParallelDFS::ParallelDFS(const ParallelOptions& options)
+        : m_options(options),
+          m_next(0),
+          m_winner(NO_SUBTREE),
+          m_started(0),
+          m_offHome(0),
+          m_contention(0),
+          m_cpus(0)
+    {
+        if (this->m_options.threads == 0)
+            this->m_options.threads = 1;
+    }
+
+    ParallelDFS::~ParallelDFS() { }
+
+    std::size_t ParallelDFS::Expand(const grid::Board& board,
+                                    grid::Board        children[GRID_SIZE],
+                                    std::size_t&       propagated,
+                                    std::size_t&       candidates)
+    {
+        const grid::Topology& topology = *this->m_options.topology;
+
+        uint16_t    row, col;
+        std::size_t count = 0;
+
+        candidates = 0;
+
+        if (not grid::FindEmptyCell(board, row, col))
+            return 0;
+
+        uint16_t valid = board.Candidates(row, col, topology);
+
+        for (uint16_t num = 1; num <= GRID_SIZE; num++)
+        {
+            if (not (valid & (1 << (num - 1))))
+                continue;
+
+            candidates++;
+
+            grid::Board& child = children[count];
+
+            grid::CopyGrid(board, child);
+            child.Set(row, col, num, topology);
+
+            if (this->m_options.propagate)
+            {
+                int filled = kernel::Active().propagate(child, topology);
+
+                // Dead end, the child is dropped
+                if (filled < 0)
+                    continue;
+
+                propagated += filled;
+            }
+
+            count++;
+        }
+
+        return count;
+    }
+
+    bool ParallelDFS::Search(const grid::Board& board,
+                             std::size_t        depth,
+                             std::size_t        index,
+                             Subtree&           subtree)
+    {
+        // A solution in an earlier subtree (or, when timing decides, in any
+        // subtree) makes the rest of this one useless
+        std::size_t winner = this->m_winner.load(std::memory_order_relaxed);
+
+        if (this->m_options.deterministic ? winner < index : winner != NO_SUBTREE)
+            return false;
+
+        grid::Board children[GRID_SIZE];
+        std::size_t candidates;
+        std::size_t count =
+            this->Expand(board, children, subtree.propagated, candidates);
+
+        subtree.expandedStates += count;
+
+        if (this->m_options.histograms)
+            subtree.shape.Expansion(depth, candidates, count);
+
+        // Solutions are checked as soon as they are generated, like the
+        // sequential engines do
+        for (std::size_t i = 0; i < count; i++)
+        {
+            if (grid::IsSolved(children[i]))
+            {
+                grid::CopyGrid(children[i], subtree.solution);
+                return true;
+            }
+        }
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            if (this->Search(children[i], depth + 1, index, subtree))
+                return true;
+        }
+
+        return false;
+    }
+
+    bool ParallelDFS::Split(const grid::Board& root)
+    {
+        trace::Span span("split", "parallel");
+
+        std::vector<grid::Board> level(1, root);
+        std::vector<grid::Board> next;
+        grid::Board              children[GRID_SIZE];
+        std::size_t              candidates;
+        std::size_t              depth = 0;
+
+        // Level by level, in generation order, so the subtrees only depend on the
+        // puzzle and never on the number of threads
+        while (not level.empty() and level.size() < SPLIT_NODES)
+        {
+            next.clear();
+
+            for (const grid::Board& board : level)
+            {
+                std::size_t count = this->Expand(
+                    board, children, this->m_splitPropagated, candidates);
+
+                this->m_splitExpanded += count;
+
+                if (this->m_options.histograms)
+                    this->m_splitShape.Expansion(depth, candidates, count);
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    if (grid::IsSolved(children[i]))
+                    {
+                        grid::CopyGrid(children[i], this->m_solution);
+                        return true;
+                    }
+
+                    next.push_back(children[i]);
+                }
+            }
+
+            level.swap(next);
+            depth++;
+        }
+
+        this->m_splitDepth = depth;
+
+        this->m_subtrees.resize(level.size());
+
+        if (this->m_options.progress != nullptr)
+            this->m_options.progress->total.store(level.size(),
+                                                  std::memory_order_relaxed);
+
+        for (std::size_t i = 0; i < level.size(); i++)
+        {
+            Subtree& subtree = this->m_subtrees[i];
+
+            grid::CopyGrid(level[i], subtree.board);
+            subtree.solved         = false;
+            subtree.expandedStates = 0;
+            subtree.propagated     = 0;
+            subtree.shape.Clear();
+        }
+
+        return false;
+    }
+
+    void ParallelDFS::Claim(std::size_t index)
+    {
+        std::size_t winner = this->m_winner.load(std::memory_order_relaxed);
+
+        // Deterministic runs keep the lowest index, others keep the first claim
+        while (this->m_options.deterministic ? index < winner : winner == NO_SUBTREE)
+        {
+            if (this->m_winner.compare_exchange_weak(winner, index))
+                return;
+
+            this->m_contention.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void ParallelDFS::Work(std::size_t thread)
+    {
+        std::size_t index;
+        int         cpu = sched_getcpu();
+
+        // Where the scheduler placed the thread, for the NUMA report of the scaling
+        // benchmark
+        if (cpu >= 0)
+            this->m_cpus.fetch_or(uint64_t(1) << std::min(cpu, 63),
+                                  std::memory_order_relaxed);
+
+        // The calling thread keeps its own name
+        if (thread > 0)
+            trace::NameThread("worker", thread);
+
+        while ((index = this->m_next.fetch_add(1)) < this->m_subtrees.size())
+        {
+            std::size_t winner = this->m_winner.load(std::memory_order_relaxed);
+
+            if (this->m_options.deterministic ? winner < index : winner != NO_SUBTREE)
+                continue;
+
+            this->m_started.fetch_add(1, std::memory_order_relaxed);
+
+            if (index % this->m_options.threads != thread)
+            {
+                this->m_offHome.fetch_add(1, std::memory_order_relaxed);
+                trace::Instant("off home", "parallel", "subtree", index);
+            }
+
+            Subtree&    subtree = this->m_subtrees[index];
+            trace::Span span("subtree", "parallel");
+
+            span.Argument("subtree", index);
+            SUDOKU_PROBE2(subtree__start, index, thread);
+
+            subtree.solved =
+                this->Search(subtree.board, this->m_splitDepth, index, subtree);
+
+            SUDOKU_PROBE3(subtree__end, index, subtree.solved, subtree.expandedStates);
+
+            if (subtree.solved)
+                this->Claim(index);
+
+            if (this->m_options.progress != nullptr)
+            {
+                this->m_options.progress->expansions.fetch_add(
+                    subtree.expandedStates, std::memory_order_relaxed);
+                this->m_options.progress->done.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool ParallelDFS::Run(const grid::Board& root)
+    {
+        this->m_subtrees.clear();
+        this->m_splitExpanded   = 0;
+        this->m_splitPropagated = 0;
+        this->m_splitDepth      = 0;
+        this->m_stats           = ParallelStats { 0, 0, 0, 0, NO_SUBTREE, 0 };
+        this->m_next            = 0;
+        this->m_winner          = NO_SUBTREE;
+        this->m_started         = 0;
+        this->m_offHome         = 0;
+        this->m_contention      = 0;
+        this->m_cpus            = 0;
+        this->m_splitShape.Clear();
+
+        bool solved = this->Split(root);
+
+        if (not solved)
+        {
+            std::vector<std::thread> workers;
+
+            for (std::size_t thread = 1; thread < this->m_options.threads; thread++)
+            {
+                workers.emplace_back(&ParallelDFS::Work, this, thread);
+            }
+
+            this->Work(0);
+
+            // Time the calling thread waits for the others, once it runs out of
+            // subtrees
+            trace::Span wait("join", "parallel");
+
+            for (std::thread& worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        std::size_t winner = this->m_winner.load();
+
+        // Deterministic counts stop at the winner, as a sequential search would
+        std::size_t counted = this->m_subtrees.size();
+
+        if (this->m_options.deterministic and winner != NO_SUBTREE)
+            counted = winner + 1;
+
+        this->m_expandedStates = this->m_splitExpanded;
+        this->m_propagated     = this->m_splitPropagated;
+        this->m_shape          = this->m_splitShape;
+
+        // Each subtree was searched by a single thread, so merging them merges
+        // the threads
+        for (std::size_t i = 0; i < counted; i++)
+        {
+            this->m_expandedStates += this->m_subtrees[i].expandedStates;
+            this->m_propagated += this->m_subtrees[i].propagated;
+
+            if (this->m_options.histograms)
+                this->m_shape.Merge(this->m_subtrees[i].shape);
+        }
+
+        if (winner != NO_SUBTREE)
+        {
+            grid::CopyGrid(this->m_subtrees[winner].solution, this->m_solution);
+            solved = true;
+        }
+
+        this->m_stats.subtrees   = this->m_subtrees.size();
+        this->m_stats.offHome    = this->m_offHome.load();
+        this->m_stats.contention = this->m_contention.load();
+        this->m_stats.winner     = winner;
+        this->m_stats.cpus       = this->m_cpus.load();
+
+        this->m_stats.searched =
+            this->m_options.deterministic ? counted : this->m_started.load();
+
+        return solved;
+    }
+} // namespace sudoku
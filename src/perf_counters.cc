@@ -0,0 +1,161 @@
+/*
+ * Filename: perf_counters.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "perf_counters.h"
+
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace perf
+{
+    /**
+     * @brief Get the cache event of a cache and result, for read accesses
+     * @param cache PERF_COUNT_HW_CACHE_* of the cache
+     * @param result PERF_COUNT_HW_CACHE_RESULT_* of the accesses
+     * @return Config of the event
+     **/
+    static uint64_t CacheEvent(uint64_t cache, uint64_t result)
+    {
+        return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (result << 16);
+    }
+
+    const char* EventName(Event event)
+    {
+        switch (event)
+        {
+            case CYCLES:
+                return "cycles";
+            case INSTRUCTIONS:
+                return "instructions";
+            case L1D_MISSES:
+                return "l1d_misses";
+            case LLC_MISSES:
+                return "llc_misses";
+            case BRANCH_MISSES:
+                return "branch_misses";
+            case DTLB_MISSES:
+                return "dtlb_misses";
+            default:
+                return "unknown";
+        }
+    }
+
+    CounterGroup::CounterGroup()
+        : m_leader(-1),
+          m_count(0)
+    {
+        // Type and config of each event, in the order of Event
+        constexpr uint32_t TYPES[EVENTS] = { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+                                             PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE,
+                                             PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE };
+        const uint64_t CONFIGS[EVENTS] = {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            CacheEvent(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_RESULT_MISS),
+            PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES,
+            CacheEvent(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_RESULT_MISS)
+        };
+
+        for (std::size_t event = 0; event < EVENTS; event++)
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+
+            attr.size           = sizeof(attr);
+            attr.type           = TYPES[event];
+            attr.config         = CONFIGS[event];
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+
+            // The leader alone starts and stops the whole group
+            attr.disabled    = this->m_leader < 0;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                               PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            this->m_fds[event] = static_cast<int>(
+                syscall(SYS_perf_event_open, &attr, 0, -1, this->m_leader, 0));
+
+            if (this->m_fds[event] < 0)
+                continue;
+
+            if (this->m_leader < 0)
+                this->m_leader = this->m_fds[event];
+
+            this->m_count++;
+        }
+    }
+
+    CounterGroup::~CounterGroup()
+    {
+        for (int fd : this->m_fds)
+        {
+            if (fd >= 0)
+                close(fd);
+        }
+    }
+
+    bool CounterGroup::IsAvailable() const
+    {
+        return this->m_leader >= 0;
+    }
+
+    void CounterGroup::Start()
+    {
+        if (this->m_leader < 0)
+            return;
+
+        ioctl(this->m_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(this->m_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    void CounterGroup::Stop()
+    {
+        if (this->m_leader < 0)
+            return;
+
+        ioctl(this->m_leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    Sample CounterGroup::Read() const
+    {
+        Sample sample = { };
+
+        // Number of events, time enabled, time running, then one value per event
+        uint64_t data[3 + EVENTS];
+
+        std::size_t expected = (3 + this->m_count) * sizeof(uint64_t);
+
+        if (this->m_leader < 0 or
+            read(this->m_leader, data, sizeof(data)) != static_cast<ssize_t>(expected))
+            return sample;
+
+        uint64_t enabled = data[1];
+        uint64_t running = data[2];
+        int      next    = 0;
+
+        for (std::size_t event = 0; event < EVENTS; event++)
+        {
+            if (this->m_fds[event] < 0)
+                continue;
+
+            uint64_t value = data[3 + next++];
+
+            // The group shared the PMU with other events for part of the time
+            if (running > 0 and running < enabled)
+                value = static_cast<uint64_t>(static_cast<double>(value) * enabled /
+                                              running);
+
+            sample.values[event]    = value;
+            sample.available[event] = true;
+        }
+
+        return sample;
+    }
+} // namespace perf
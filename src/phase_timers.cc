@@ -0,0 +1,31 @@
+/*
+ * Filename: phase_timers.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "phase_timers.h"
+
+namespace phase
+{
+    const char* PhaseName(Phase phase)
+    {
+        switch (phase)
+        {
+            case BOARD:
+                return "board";
+            case EXPAND:
+                return "expand";
+            case CHECK:
+                return "check";
+            case HEURISTIC:
+                return "heuristic";
+            case FRONTIER:
+                return "frontier";
+            case RELEASE:
+                return "release";
+            default:
+                return "unknown";
+        }
+    }
+} // namespace phase
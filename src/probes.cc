@@ -0,0 +1,23 @@
+/*
+ * Filename: probes.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "probes.h"
+
+#ifdef SUDOKU_PROBES_ENABLED
+#define SUDOKU_DEFINE_SEMAPHORE(name)                                                  \
+    __extension__ unsigned short SUDOKU_SEMAPHORE(name)                                \
+        __attribute__((unused)) __attribute__((section(".probes"))) = 0
+
+SUDOKU_DEFINE_SEMAPHORE(solve__start);
+SUDOKU_DEFINE_SEMAPHORE(solve__end);
+SUDOKU_DEFINE_SEMAPHORE(expand);
+SUDOKU_DEFINE_SEMAPHORE(push);
+SUDOKU_DEFINE_SEMAPHORE(pop);
+SUDOKU_DEFINE_SEMAPHORE(propagate);
+SUDOKU_DEFINE_SEMAPHORE(goal);
+SUDOKU_DEFINE_SEMAPHORE(subtree__start);
+SUDOKU_DEFINE_SEMAPHORE(subtree__end);
+#endif
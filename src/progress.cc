@@ -0,0 +1,200 @@
+/*
+ * Filename: progress.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "progress.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <unistd.h>
+
+namespace progress
+{
+    void Counters::Clear()
+    {
+        this->expansions.store(0, std::memory_order_relaxed);
+        this->frontier.store(0, std::memory_order_relaxed);
+        this->depth.store(0, std::memory_order_relaxed);
+        this->f.store(0, std::memory_order_relaxed);
+        this->limit.store(0, std::memory_order_relaxed);
+        this->done.store(0, std::memory_order_relaxed);
+        this->total.store(0, std::memory_order_relaxed);
+    }
+
+    bool ParsePeriod(const char* text, Settings& settings)
+    {
+        char*    end;
+        uint64_t value = std::strtoull(text, &end, 10);
+
+        if (end == text or value == 0)
+            return false;
+
+        if (std::strcmp(end, "ms") == 0)
+        {
+            settings.periodNs = value * 1000000;
+            return true;
+        }
+
+        settings.periodNs = value * 1000000000;
+
+        return *end == '\0';
+    }
+
+    /**
+     * @brief Get the resident memory of the process
+     * @return Resident bytes, 0 without /proc
+     **/
+    static uint64_t ResidentBytes()
+    {
+        std::FILE* file     = std::fopen("/proc/self/statm", "r");
+        uint64_t   size     = 0;
+        uint64_t   resident = 0;
+
+        if (file == nullptr)
+            return 0;
+
+        if (std::fscanf(file, "%" SCNu64 " %" SCNu64, &size, &resident) != 2)
+            resident = 0;
+
+        std::fclose(file);
+
+        return resident * sysconf(_SC_PAGESIZE);
+    }
+
+    Heartbeat::Heartbeat(const Counters& counters,
+                         const Settings& settings,
+                         const char*     name)
+        : m_counters(counters),
+          m_settings(settings),
+          m_name(name),
+          m_stop(false)
+    {
+        this->m_thread = std::thread(&Heartbeat::Run, this);
+    }
+
+    Heartbeat::~Heartbeat()
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            this->m_stop = true;
+        }
+
+        this->m_wake.notify_one();
+        this->m_thread.join();
+    }
+
+    void Heartbeat::Run()
+    {
+        using Clock = std::chrono::steady_clock;
+
+        Clock::time_point start    = Clock::now();
+        Clock::time_point previous = start;
+        uint64_t          last     = 0;
+
+        std::chrono::nanoseconds     period(this->m_settings.periodNs);
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+
+        auto load = [](const auto& counter)
+        {
+            return counter.load(std::memory_order_relaxed);
+        };
+
+        auto stopped = [this]()
+        {
+            return this->m_stop;
+        };
+
+        while (not this->m_wake.wait_for(lock, period, stopped))
+        {
+            Clock::time_point now = Clock::now();
+
+            double elapsed = std::chrono::duration<double>(now - start).count();
+            double seconds = std::chrono::duration<double>(now - previous).count();
+
+            const Counters& counters   = this->m_counters;
+            uint64_t        expansions = load(counters.expansions);
+            uint64_t        done       = load(counters.done);
+            uint64_t        total      = load(counters.total);
+            uint32_t        f          = load(counters.f);
+            uint32_t        limit      = load(counters.limit);
+
+            char        field[64];
+            std::string line = this->m_name;
+
+            std::snprintf(field,
+                          sizeof(field),
+                          " %.1f s, %" PRIu64 " expanded, %.0f nodes/s",
+                          elapsed,
+                          expansions,
+                          seconds > 0 ? (expansions - last) / seconds : 0.0);
+            line += field;
+
+            std::snprintf(field,
+                          sizeof(field),
+                          ", frontier %" PRIu64 ", depth %" PRIu32,
+                          load(counters.frontier),
+                          load(counters.depth));
+            line += field;
+
+            if (f > 0)
+            {
+                std::snprintf(field, sizeof(field), ", f %" PRIu32, f);
+                line += field;
+            }
+
+            if (limit > 0)
+            {
+                std::snprintf(field, sizeof(field), ", limit %" PRIu32, limit);
+                line += field;
+            }
+
+            std::snprintf(
+                field, sizeof(field), ", rss %.1f MiB", ResidentBytes() / 1048576.0);
+            line += field;
+
+            // Assumes the remaining work goes at the pace of the finished one
+            if (total > 0 and done > 0)
+                std::snprintf(field,
+                              sizeof(field),
+                              ", %" PRIu64 "/%" PRIu64 " done, eta %.1f s",
+                              done,
+                              total,
+                              elapsed * (total - std::min(done, total)) / done);
+            else
+                std::snprintf(field, sizeof(field), ", eta -");
+
+            line += field;
+
+            if (this->m_settings.statusFile == nullptr)
+            {
+                std::fprintf(stderr, "[heartbeat] %s\n", line.c_str());
+            }
+            else
+            {
+                // Written aside and renamed, so readers never see half a line
+                std::string temporary = this->m_settings.statusFile;
+                temporary += ".tmp";
+
+                std::FILE* file = std::fopen(temporary.c_str(), "w");
+
+                if (file != nullptr)
+                {
+                    std::fprintf(file, "%s\n", line.c_str());
+                    std::fclose(file);
+                    std::rename(temporary.c_str(), this->m_settings.statusFile);
+                }
+            }
+
+            previous = now;
+            last     = expansions;
+        }
+    }
+} // namespace progress
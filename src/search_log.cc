@@ -0,0 +1,434 @@
+/*
+ * Filename: search_log.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "search_log.h"
+
+#include <cstring>
+
+namespace searchlog
+{
+    constexpr char        MAGIC[8]   = { 'S', 'D', 'K', 'L', 'O', 'G', '1', '\0' };
+    constexpr std::size_t HASH_BITS  = 12;      /**< Entries of the match finder */
+    constexpr std::size_t MIN_MATCH  = 4;       /**< Shortest match worth coding */
+    constexpr std::size_t MAX_OFFSET = 1 << 16; /**< Farthest match, one block */
+
+    const char* KindName(Kind kind)
+    {
+        switch (kind)
+        {
+            case EXPAND:
+                return "expand";
+            case CHILD:
+                return "child";
+            case PRUNE:
+                return "prune";
+            case DEAD_END:
+                return "dead end";
+            case CUTOFF:
+                return "cutoff";
+            case GOAL:
+                return "goal";
+            case END:
+                return "end";
+            default:
+                return "unknown";
+        }
+    }
+
+    /**
+     * @brief Append an unsigned integer, 7 bits per byte
+     * @param value Value to append
+     * @param output Destination
+     **/
+    static void PutVarint(std::size_t value, std::vector<uint8_t>& output)
+    {
+        while (value >= 0x80)
+        {
+            output.push_back(static_cast<uint8_t>(value) | 0x80);
+            value >>= 7;
+        }
+
+        output.push_back(static_cast<uint8_t>(value));
+    }
+
+    /**
+     * @brief Read an integer written by PutVarint
+     * @param input Source
+     * @param position Position in the source, advanced past the integer
+     * @param value Receives the value
+     * @return False if the source ends first
+     **/
+    static bool GetVarint(const std::vector<uint8_t>& input,
+                          std::size_t&                position,
+                          std::size_t&                value)
+    {
+        value = 0;
+
+        for (unsigned shift = 0; position < input.size() and shift < 64; shift += 7)
+        {
+            uint8_t byte = input[position++];
+
+            value |= static_cast<std::size_t>(byte & 0x7f) << shift;
+
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    void Compress(const std::vector<uint8_t>& input, std::vector<uint8_t>& output)
+    {
+        std::vector<uint32_t> table(1 << HASH_BITS, UINT32_MAX);
+        std::size_t           anchor = 0;
+        std::size_t           i      = 0;
+
+        output.clear();
+
+        // Sequences of literals, each followed by a match: literal count,
+        // literals, match length minus MIN_MATCH, match offset. The last
+        // sequence has no match
+        while (i + MIN_MATCH <= input.size())
+        {
+            uint32_t word;
+            std::memcpy(&word, input.data() + i, sizeof(word));
+
+            uint32_t  hash      = (word * 2654435761u) >> (32 - HASH_BITS);
+            uint32_t  candidate = table[hash];
+            table[hash]         = static_cast<uint32_t>(i);
+
+            if (candidate == UINT32_MAX or i - candidate >= MAX_OFFSET or
+                std::memcmp(input.data() + candidate, input.data() + i, MIN_MATCH) != 0)
+            {
+                i++;
+                continue;
+            }
+
+            std::size_t length = MIN_MATCH;
+
+            while (i + length < input.size() and
+                   input[candidate + length] == input[i + length])
+            {
+                length++;
+            }
+
+            PutVarint(i - anchor, output);
+            output.insert(output.end(), input.begin() + anchor, input.begin() + i);
+            PutVarint(length - MIN_MATCH, output);
+            PutVarint(i - candidate, output);
+
+            i += length;
+            anchor = i;
+        }
+
+        PutVarint(input.size() - anchor, output);
+        output.insert(output.end(), input.begin() + anchor, input.end());
+    }
+
+    bool Decompress(const std::vector<uint8_t>& input,
+                    std::size_t                 size,
+                    std::vector<uint8_t>&       output)
+    {
+        std::size_t position = 0;
+
+        output.clear();
+        output.reserve(size);
+
+        while (true)
+        {
+            std::size_t literals, length, offset;
+
+            if (not GetVarint(input, position, literals) or
+                literals > input.size() - position or
+                literals > size - output.size())
+                return false;
+
+            output.insert(output.end(),
+                          input.begin() + position,
+                          input.begin() + position + literals);
+            position += literals;
+
+            if (output.size() == size)
+                return position == input.size();
+
+            if (not GetVarint(input, position, length) or
+                not GetVarint(input, position, offset) or offset == 0 or
+                offset > output.size() or length + MIN_MATCH > size - output.size())
+                return false;
+
+            // Byte by byte, since a match may overlap the bytes it produces
+            for (std::size_t k = 0; k < length + MIN_MATCH; k++)
+            {
+                output.push_back(output[output.size() - offset]);
+            }
+        }
+    }
+
+    /**
+     * @brief Write a 32-bit value in little-endian order
+     * @param value Value to write
+     * @param file Destination
+     **/
+    static void PutWord(uint32_t value, std::FILE* file)
+    {
+        uint8_t bytes[4] = { static_cast<uint8_t>(value),
+                             static_cast<uint8_t>(value >> 8),
+                             static_cast<uint8_t>(value >> 16),
+                             static_cast<uint8_t>(value >> 24) };
+
+        std::fwrite(bytes, 1, sizeof(bytes), file);
+    }
+
+    /**
+     * @brief Read a value written by PutWord
+     * @param file Source
+     * @param value Receives the value
+     * @return False at the end of the file
+     **/
+    static bool GetWord(std::FILE* file, uint32_t& value)
+    {
+        uint8_t bytes[4];
+
+        if (std::fread(bytes, 1, sizeof(bytes), file) != sizeof(bytes))
+            return false;
+
+        value = bytes[0] | bytes[1] << 8 | bytes[2] << 16 |
+                static_cast<uint32_t>(bytes[3]) << 24;
+
+        return true;
+    }
+
+    Log::Log(const char* path, const Header& header)
+        : m_file(std::fopen(path, "wb")),
+          m_replaying(false),
+          m_header(header),
+          m_closing(false),
+          m_position(0),
+          m_read(0),
+          m_diverged(false)
+    {
+        if (this->m_file == nullptr)
+            return;
+
+        // Header: magic, algorithm, flags, seed, variant and grid
+        uint8_t flags = header.propagate ? 1 : 0;
+
+        std::fwrite(MAGIC, 1, sizeof(MAGIC), this->m_file);
+        std::fputc(header.algorithm, this->m_file);
+        std::fputc(flags, this->m_file);
+        PutWord(static_cast<uint32_t>(header.seed), this->m_file);
+        PutWord(static_cast<uint32_t>(header.seed >> 32), this->m_file);
+        PutWord(static_cast<uint32_t>(header.variant.size()), this->m_file);
+        std::fwrite(header.variant.data(), 1, header.variant.size(), this->m_file);
+        std::fwrite(header.cells, 1, sizeof(header.cells), this->m_file);
+
+        this->m_block.reserve(BLOCK_SIZE);
+        this->m_writer = std::thread(&Log::Write, this);
+    }
+
+    Log::Log(const char* path)
+        : m_file(std::fopen(path, "rb")),
+          m_replaying(true),
+          m_header(),
+          m_closing(false),
+          m_position(0),
+          m_read(0),
+          m_diverged(false)
+    {
+        if (this->m_file == nullptr)
+            return;
+
+        char     magic[sizeof(MAGIC)];
+        uint32_t low, high, length;
+        int      algorithm = EOF;
+        int      flags     = EOF;
+
+        bool valid =
+            std::fread(magic, 1, sizeof(magic), this->m_file) == sizeof(magic) and
+            std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0 and
+            (algorithm = std::fgetc(this->m_file)) != EOF and
+            (flags = std::fgetc(this->m_file)) != EOF and
+            GetWord(this->m_file, low) and GetWord(this->m_file, high) and
+            GetWord(this->m_file, length) and length <= 256;
+
+        if (valid)
+        {
+            this->m_header.algorithm = static_cast<char>(algorithm);
+            this->m_header.propagate = (flags & 1) != 0;
+            this->m_header.seed      = static_cast<uint64_t>(high) << 32 | low;
+            this->m_header.variant.resize(length);
+
+            Header& header = this->m_header;
+
+            valid = std::fread(header.variant.data(), 1, length, this->m_file) ==
+                        length and
+                    std::fread(header.cells, 1, sizeof(header.cells), this->m_file) ==
+                        sizeof(header.cells);
+        }
+
+        if (not valid)
+        {
+            std::fclose(this->m_file);
+            this->m_file = nullptr;
+        }
+    }
+
+    Log::~Log()
+    {
+        if (this->m_file == nullptr)
+            return;
+
+        if (not this->m_replaying)
+        {
+            if (not this->m_block.empty())
+                this->Submit();
+
+            {
+                std::lock_guard<std::mutex> lock(this->m_mutex);
+                this->m_closing = true;
+            }
+
+            this->m_ready.notify_one();
+            this->m_writer.join();
+        }
+
+        std::fclose(this->m_file);
+    }
+
+    void Log::Submit()
+    {
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+
+        // Only waits when the disk is slower than the search
+        this->m_drained.wait(
+            lock, [this]() { return this->m_pending.size() < MAX_PENDING; });
+
+        this->m_pending.push_back(std::move(this->m_block));
+        lock.unlock();
+
+        this->m_ready.notify_one();
+
+        this->m_block = std::vector<uint8_t>();
+        this->m_block.reserve(BLOCK_SIZE);
+    }
+
+    void Log::Write()
+    {
+        std::vector<uint8_t> compressed;
+
+        while (true)
+        {
+            std::vector<uint8_t> block;
+
+            {
+                std::unique_lock<std::mutex> lock(this->m_mutex);
+
+                this->m_ready.wait(lock,
+                                   [this]()
+                                   {
+                                       return this->m_closing or
+                                              not this->m_pending.empty();
+                                   });
+
+                if (this->m_pending.empty())
+                    return;
+
+                block = std::move(this->m_pending.front());
+                this->m_pending.pop_front();
+            }
+
+            this->m_drained.notify_one();
+
+            Compress(block, compressed);
+
+            // Blocks that do not shrink are stored as they are
+            bool stored = compressed.size() >= block.size();
+
+            const std::vector<uint8_t>& data = stored ? block : compressed;
+
+            PutWord(static_cast<uint32_t>(block.size()), this->m_file);
+            PutWord(static_cast<uint32_t>(data.size()), this->m_file);
+            std::fwrite(data.data(), 1, data.size(), this->m_file);
+        }
+    }
+
+    bool Log::Get(uint8_t& byte)
+    {
+        if (this->m_position == this->m_events.size())
+        {
+            uint32_t             size, stored;
+            std::vector<uint8_t> data;
+
+            if (not GetWord(this->m_file, size) or not GetWord(this->m_file, stored) or
+                size == 0 or size > BLOCK_SIZE or stored > size)
+                return false;
+
+            data.resize(stored);
+
+            if (std::fread(data.data(), 1, stored, this->m_file) != stored)
+                return false;
+
+            if (stored == size)
+                this->m_events.swap(data);
+            else if (not Decompress(data, size, this->m_events))
+                return false;
+
+            this->m_position = 0;
+        }
+
+        byte = this->m_events[this->m_position++];
+
+        return true;
+    }
+
+    uint8_t Log::Expect(Kind kind, uint8_t value, int second)
+    {
+        uint8_t byte  = 0;
+        uint8_t extra = 0;
+        bool    found = this->Get(byte);
+
+        Kind    logged      = static_cast<Kind>(byte >> 5);
+        uint8_t loggedValue = byte & 0x1f;
+
+        if (found and (logged == EXPAND or logged == CHILD))
+            found = this->Get(extra);
+
+        if (this->m_diverged)
+            return extra;
+
+        if (not found or logged != kind or loggedValue != value or
+            (second >= 0 and extra != second))
+        {
+            char text[128];
+
+            if (found)
+                std::snprintf(text,
+                              sizeof(text),
+                              "event %llu: log has %s %u/%u, search did %s %u/%d",
+                              static_cast<unsigned long long>(this->m_read),
+                              KindName(logged),
+                              loggedValue,
+                              extra,
+                              KindName(kind),
+                              value,
+                              second);
+            else
+                std::snprintf(text,
+                              sizeof(text),
+                              "event %llu: log ended, search did %s %u",
+                              static_cast<unsigned long long>(this->m_read),
+                              KindName(kind),
+                              value);
+
+            this->m_diverged   = true;
+            this->m_divergence = text;
+        }
+
+        this->m_read++;
+
+        return extra;
+    }
+} // namespace searchlog
@@ -0,0 +1,82 @@
+/*
+ * Filename: search_node.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "search_node.h"
+
+namespace sudoku
+{
+    NodeStore::NodeStore() { }
+
+    NodeStore::~NodeStore() { }
+
+    void NodeStore::Clear()
+    {
+        // Keep the capacity, so the next search does not hit the allocator again
+        this->m_nodes.clear();
+        this->m_payloads.clear();
+        this->m_freePayloads.clear();
+    }
+
+    uint32_t NodeStore::AcquirePayload()
+    {
+        if (not this->m_freePayloads.empty())
+        {
+            uint32_t handle = this->m_freePayloads.back();
+            this->m_freePayloads.pop_back();
+
+            return handle;
+        }
+
+        this->m_payloads.emplace_back();
+
+        return static_cast<uint32_t>(this->m_payloads.size() - 1);
+    }
+
+    uint32_t NodeStore::AddRoot(const grid::Board& board)
+    {
+        SearchNode root = { };
+
+        root.parent  = NO_PARENT;
+        root.payload = this->AcquirePayload();
+
+        this->m_payloads[root.payload] = board;
+
+        this->m_nodes.push_back(root);
+
+        return static_cast<uint32_t>(this->m_nodes.size() - 1);
+    }
+
+    uint32_t NodeStore::AddChild(uint32_t              father,
+                                 uint16_t              row,
+                                 uint16_t              col,
+                                 uint16_t              num,
+                                 const grid::Topology& topology)
+    {
+        SearchNode child = { };
+
+        child.depth   = this->m_nodes[father].depth + 1;
+        child.row     = row;
+        child.col     = col;
+        child.num     = num;
+        child.parent  = father;
+        child.payload = this->AcquirePayload();
+
+        // The payload array may have grown, so only index it after acquiring the
+        // slot of the child
+        this->m_payloads[child.payload] =
+            this->m_payloads[this->m_nodes[father].payload];
+        this->m_payloads[child.payload].Set(row, col, num, topology);
+
+        this->m_nodes.push_back(child);
+
+        return static_cast<uint32_t>(this->m_nodes.size() - 1);
+    }
+
+    void NodeStore::Release(uint32_t id)
+    {
+        this->m_freePayloads.push_back(this->m_nodes[id].payload);
+    }
+} // namespace sudoku
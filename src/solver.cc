@@ -6,13 +6,32 @@
 
 #include "solver.h"
 
+#include "probes.h"
+
 namespace sudoku
 {
-    Solver::Solver(uint16_t grid[GRID_SIZE][GRID_SIZE], Algorithm algorithm)
+    Solver::Solver(uint16_t             grid[GRID_SIZE][GRID_SIZE],
+                   Algorithm            algorithm,
+                   const SolverOptions& options)
+        : m_burst("expand", "search", EXPAND_BURST)
     {
-        this->m_algorithm        = algorithm;
-        this->m_vertexSolutionID = 0;
-        this->m_expandedStates   = 0;
+        this->m_algorithm      = algorithm;
+        this->m_options        = options;
+        this->m_solutionNode   = NO_PARENT;
+        this->m_expandedStates = 0;
+        this->m_expansions     = 0;
+        this->m_moves          = 0;
+        this->m_propagated     = 0;
+        this->m_frontier       = 0;
+        this->m_series         = series::Recorder(options.series);
+        this->m_log            = nullptr;
+        this->m_parallelStats  = ParallelStats { 0, 0, 0, 0, NO_SUBTREE, 0 };
+
+        if (this->m_options.seed == 0)
+            this->m_options.seed =
+                std::chrono::system_clock::now().time_since_epoch().count();
+
+        this->m_random.seed(this->m_options.seed);
 
         for (int i = 0; i < GRID_SIZE; i++)
         {
@@ -21,582 +40,1126 @@ namespace sudoku
                 this->m_startGrid[i][j] = grid[i][j];
             }
         }
+
+        // Numbers out of range are left as invalid cells, which Run rejects
+        grid::FromGrid(
+            this->m_startGrid, this->m_startBoard, *this->m_options.topology);
+
+        this->m_children.reserve(GRID_SIZE);
     }
 
     Solver::~Solver() { }
 
-    void
-    Solver::GetVertexState(graph::Vertex<uint16_t, uint16_t, Vector<State>>& vertex,
-                           uint16_t grid[GRID_SIZE][GRID_SIZE])
+    uint64_t Solver::PriorityKey(uint32_t id)
     {
-        grid::CopyGrid(this->m_startGrid, grid);
-
-        // Since each vertex stores a history of changes, it is possible to use
-        // these changes to reconstruct the new current grid
-        Vector<State> changes = vertex.GetData();
-
-        grid::ApplyChanges(grid, changes);
+        return (static_cast<uint64_t>(this->m_nodes.Node(id).f) << 32) | id;
     }
 
     uint16_t Solver::GenRandomCost()
     {
-        unsigned     seed = std::chrono::system_clock::now().time_since_epoch().count();
-        std::mt19937 generator(seed);
-
         std::uniform_int_distribution<int> distribution(1, GRID_SIZE + 1);
 
-        return distribution(generator);
+        return distribution(this->m_random);
     }
 
-    uint16_t Solver::CalculateAStarHeuristic(
-        graph::Vertex<uint16_t, uint16_t, Vector<State>>& vertex)
+    uint16_t Solver::StepCost(uint16_t num)
     {
+        if (this->m_log == nullptr)
+            return this->GenRandomCost();
 
-        uint16_t currentGrid[GRID_SIZE][GRID_SIZE];
+        // A replay takes the costs of the recorded run, without the generator
+        if (this->m_log->IsReplaying())
+            return this->m_log->ReplayChild(num);
 
-        this->GetVertexState(vertex, currentGrid);
+        uint16_t cost = this->GenRandomCost();
+        this->m_log->Child(num, cost);
 
-        uint16_t possibleNumbers = 0;
+        return cost;
+    }
 
-        Vector<State> changes = vertex.GetData();
+    uint16_t Solver::CalculateAStarHeuristic(uint32_t id)
+    {
+        phase::Scope scope(this->m_phases, phase::HEURISTIC);
 
-        if (not changes.IsEmpty())
-        {
-            uint16_t row, col;
+        SearchNode& node = this->m_nodes.Node(id);
 
-            row = changes.Back().GetFirst().GetFirst();
-            col = changes.Back().GetFirst().GetSecond();
+        // If the node has no changes, that is, it is the root node, the cost
+        // is GRID_SIZE
+        if (node.parent == NO_PARENT)
+            return GRID_SIZE;
 
-            for (uint16_t num = 1; num <= GRID_SIZE; num++)
-            {
-                if (grid::IsValid(currentGrid, row, col, num))
-                    possibleNumbers++;
-            }
+        // The cell itself is filled, so its own number is never counted
+        return std::popcount(this->m_nodes.Payload(id).Candidates(
+            node.row, node.col, *this->m_options.topology));
+    }
+
+    uint16_t Solver::CalculateGreedyBFSHeuristic(uint32_t id)
+    {
+        phase::Scope scope(this->m_phases, phase::HEURISTIC);
 
-            return possibleNumbers;
+        grid::Board& board = this->m_nodes.Payload(id);
+
+        // Each filled cell sets exactly one bit in the mask of its row
+        uint16_t filledCells = 0;
+
+        for (uint16_t row = 0; row < GRID_SIZE; row++)
+        {
+            filledCells += std::popcount(board.unitMask[grid::ROW_UNITS + row]);
         }
 
-        // If the vertex has no changes, that is, it is the root vertex, the cost
-        // is GRID_SIZE
-        return GRID_SIZE;
+        return grid::BOARD_CELLS - filledCells;
     }
 
-    uint16_t Solver::CalculateGreedyBFSHeuristic(
-        graph::Vertex<uint16_t, uint16_t, Vector<State>>& vertex)
+    template<typename Observer>
+    uint32_t Solver::CreateInitialState(Observer& observer)
     {
+        // Make sure the tree is empty
+        this->m_nodes.Clear();
 
-        uint16_t currentGrid[GRID_SIZE][GRID_SIZE];
+        // Create the root node
+        uint32_t root = this->m_nodes.AddRoot(this->m_startBoard);
 
-        this->GetVertexState(vertex, currentGrid);
+        if (this->m_options.propagate)
+        {
+            trace::Span span("propagate", "search");
 
-        uint16_t emptyCells = 0;
+            int filled = kernel::Active().propagate(this->m_nodes.Payload(root),
+                                                    *this->m_options.topology);
 
-        for (uint16_t row = 0; row < GRID_SIZE; row++)
-        {
-            for (uint16_t col = 0; col < GRID_SIZE; col++)
-            {
-                if (currentGrid[row][col] == 0)
-                    emptyCells++;
-            }
+            observer.OnPropagate(root, filled);
+
+            if (filled < 0)
+                return NO_PARENT;
+
+            this->m_propagated += filled;
         }
 
-        return emptyCells;
+        return root;
     }
 
-    void Solver::CreateInitialState()
+    template<typename Observer>
+    bool Solver::CheckSolution(uint32_t id, Observer& observer)
     {
-        // Make sure the graph is empty
-        this->m_graph.Destroy();
+        phase::Scope scope(this->m_phases, phase::CHECK);
 
-        // Create the root vertex
-        this->m_graph.AddVertex(Vector<State>())
-            .SetLabel(graph::VertexLabel::UNVISITED);
+        bool solved = grid::IsSolved(this->m_nodes.Payload(id));
+
+        if (solved)
+            observer.OnGoal(id, this->m_nodes.Node(id).depth, this->m_expansions);
+
+        return solved;
     }
 
-    bool Solver::CheckSolution(graph::Vertex<uint16_t, uint16_t, Vector<State>>& vertex)
+    template<typename Observer>
+    void Solver::Pushed(uint32_t id, Observer& observer)
     {
-        uint16_t currentGrid[GRID_SIZE][GRID_SIZE];
-
-        this->GetVertexState(vertex, currentGrid);
+        this->m_frontier++;
+        observer.OnPush(id, this->m_frontier);
+    }
 
-        return grid::IsSolved(currentGrid);
+    template<typename Observer>
+    void Solver::Popped(uint32_t id, Observer& observer)
+    {
+        this->m_frontier--;
+        observer.OnPop(id, this->m_frontier);
     }
 
-    void Solver::ExpandNode(graph::Vertex<uint16_t, uint16_t, Vector<State>>& father)
+    template<typename Observer>
+    void Solver::ExpandNode(uint32_t father, Observer& observer)
     {
-        uint16_t currentGrid[GRID_SIZE][GRID_SIZE];
+        phase::Scope scope(this->m_phases, phase::EXPAND);
+
+        this->m_children.clear();
+        this->m_expansions++;
 
-        this->GetVertexState(father, currentGrid);
-        Vector<State> changes = father.GetData();
+        observer.OnExpand(
+            father, this->m_nodes.Node(father), this->m_expansions, this->m_frontier);
+
+        // Adding children may move the payload array, so work on a local copy of
+        // the board of the father
+        grid::Board currentBoard;
+
+        {
+            phase::Scope copy(this->m_phases, phase::BOARD);
+            grid::CopyGrid(this->m_nodes.Payload(father), currentBoard);
+        }
 
         // Find the first empty cell to expand
-        uint16_t row, col;
-        grid::FindEmptyCell(currentGrid, row, col);
+        uint16_t              row, col;
+        const grid::Topology& topology = *this->m_options.topology;
+
+        if (not grid::FindEmptyCell(currentBoard, row, col))
+            return;
+
+        observer.OnChoose(currentBoard, row, col);
+
+        // The masks of the units give every valid number of the cell at once
+        uint16_t candidates = currentBoard.Candidates(row, col, topology);
 
         for (uint16_t num = 1; num <= GRID_SIZE; num++)
         {
             // For each possible number, check if it is valid and expand the node
-            if (grid::IsValid(currentGrid, row, col, num))
+            if (candidates & (1 << (num - 1)))
             {
-                // Create a new state with the change
-                changes.PushBack(State(Pair<uint16_t, uint16_t>(row, col), num));
+                uint32_t child;
 
-                // Create a new vertex and add it to the graph
-                graph::Vertex<uint16_t, uint16_t, Vector<State>>& child =
-                    this->m_graph.AddVertex(changes);
+                {
+                    phase::Scope copy(this->m_phases, phase::BOARD);
+                    child = this->m_nodes.AddChild(father, row, col, num, topology);
+                }
 
-                child.SetCurrentCost(this->GenRandomCost());
+                if (this->m_options.propagate)
+                {
+                    int filled = kernel::Active().propagate(
+                        this->m_nodes.Payload(child), topology);
 
-                child.SetLabel(graph::VertexLabel::UNVISITED);
+                    observer.OnPropagate(child, filled);
 
-                this->m_graph.AddEdge(father.GetID(), child.GetID());
+                    // Dead end, the child will never be visited
+                    if (filled < 0)
+                    {
+                        observer.OnPrune(father, num);
+                        this->ReleaseNode(child);
+                        continue;
+                    }
+
+                    this->m_propagated += filled;
+                }
+
+                this->m_nodes.Node(child).g =
+                    this->m_nodes.Node(father).g + this->StepCost(num);
+
+                this->m_children.push_back(child);
 
                 this->m_expandedStates++;
+
+                observer.OnGenerate(father, child, num);
             }
         }
-        father.SetLabel(graph::VertexLabel::PROCESSING);
+
+        if (this->m_children.empty())
+            observer.OnBacktrack(
+                father, this->m_nodes.Node(father).depth, observe::DEAD_END);
+    }
+
+    void Solver::ReleaseNode(uint32_t id)
+    {
+        phase::Scope scope(this->m_phases, phase::RELEASE);
+
+        this->m_nodes.Release(id);
     }
 
-    void Solver::PrintState(graph::Vertex<uint16_t, uint16_t, Vector<State>>& vertex,
-                            bool pythonStyle)
+    searchlog::Header Solver::LogHeader()
     {
-        uint16_t currentGrid[GRID_SIZE][GRID_SIZE];
+        const grid::Topology& topology = *this->m_options.topology;
+        searchlog::Header     header;
 
-        this->GetVertexState(vertex, currentGrid);
+        header.algorithm = static_cast<char>(this->m_algorithm);
+        header.propagate = this->m_options.propagate;
+        header.seed      = this->m_options.seed;
+        header.variant   = topology.name;
 
+        // Irregular regions are only known by their table
+        if (header.variant == "jigsaw")
+        {
+            header.variant += ':';
+
+            for (std::size_t cell = 0; cell < grid::BOARD_CELLS; cell++)
+            {
+                header.variant += static_cast<char>('1' + topology.region[cell]);
+            }
+        }
+
+        for (std::size_t cell = 0; cell < grid::BOARD_CELLS; cell++)
+        {
+            header.cells[cell] = this->m_startGrid[cell / GRID_SIZE][cell % GRID_SIZE];
+        }
+
+        return header;
+    }
+
+    void Solver::PrintState(uint32_t id, bool pythonStyle)
+    {
         if (pythonStyle)
         {
-            grid::PrintGridPythonStyle(currentGrid);
+            grid::PrintGridPythonStyle(this->m_nodes.Payload(id));
         }
         else
         {
-            grid::PrintGrid(currentGrid);
+            grid::PrintGrid(this->m_nodes.Payload(id));
         }
     }
 
-    bool Solver::BFS()
+    template<typename Observer>
+    bool Solver::BFS(Observer& observer)
     {
-        this->CreateInitialState();
+        slkd::Queue<uint32_t> queue;
 
-        slkd::Queue<graph::Vertex<uint16_t, uint16_t, Vector<State>>*> queue;
+        uint32_t root = this->CreateInitialState(observer);
 
-        queue.Enqueue(&this->m_graph.GetVertex(0));
+        if (root == NO_PARENT)
+            return false;
 
-        // Auxiliar variables to make code most legible
-        graph::Vertex<uint16_t, uint16_t, Vector<State>>* u = nullptr;
-        graph::Vertex<uint16_t, uint16_t, Vector<State>>* v = nullptr;
+        // Propagation alone may have solved the puzzle
+        if (this->CheckSolution(root, observer))
+        {
+            this->m_solutionNode = root;
+            return true;
+        }
 
-        graph::Edge<uint16_t, uint16_t, Vector<State>>* uv;
+        queue.Enqueue(root);
+        this->Pushed(root, observer);
+
+        uint32_t u;
 
         while (not queue.IsEmpty())
         {
-            u = queue.Dequeue();
-
-            // Expand the node, that is, generate all possible and valid children
-            this->ExpandNode(*u);
+            this->m_phases.Iteration();
 
-            // Pair<first, second> = <ID, Edge>
-            for (auto& pair : u->GetAdjacencyList())
             {
-                // Edge uv (or vu, if is non-directed uv = vu)
-                uv = pair.GetSecond();
+                phase::Scope pop(this->m_phases, phase::FRONTIER);
+                u = queue.Dequeue();
+                this->Popped(u, observer);
+            }
 
-                // Get the pointer do neighbor vertex, since one end of the edge is
-                // vertex u, and the other end is vertex v
-                uv->GetVertices().GetFirst()->GetID() == u->GetID()
-                    ? v = &this->m_graph.GetVertex(
-                          uv->GetVertices().GetSecond()->GetID())
-                    : v = &this->m_graph.GetVertex(
-                          uv->GetVertices().GetFirst()->GetID());
+            // Expand the node, that is, generate all possible and valid children
+            this->ExpandNode(u, observer);
 
+            for (uint32_t v : this->m_children)
+            {
                 // Check if the solution was found
-                if (this->CheckSolution(*v))
+                if (this->CheckSolution(v, observer))
                 {
-                    this->m_vertexSolutionID = v->GetID();
+                    this->m_solutionNode = v;
                     return true;
                 }
 
-                if (v->GetLabel() == graph::VertexLabel::UNVISITED)
-                    queue.Enqueue(v);
+                phase::Scope push(this->m_phases, phase::FRONTIER);
+                queue.Enqueue(v);
+                this->Pushed(v, observer);
             }
 
-            // After expanding a vertex, since we won't visit it again, we remove the
-            // node from the graph to save memory
-            this->m_graph.RemoveVertex(u->GetID());
+            // After expanding a node, since we won't visit it again, we release its
+            // board to save memory
+            this->ReleaseNode(u);
         }
 
         return false;
     }
 
-    bool Solver::IDDFS(std::size_t maxDepth)
+    template<typename Observer>
+    bool Solver::IDDFS(Observer& observer, std::size_t maxDepth)
     {
-        // Auxiliar variables to make code most legible
-        graph::Vertex<uint16_t, uint16_t, Vector<State>>* u = nullptr;
-        graph::Vertex<uint16_t, uint16_t, Vector<State>>* v = nullptr;
-
-        graph::Edge<uint16_t, uint16_t, Vector<State>>* uv;
+        uint32_t u;
 
         for (std::size_t depth = 1; depth <= maxDepth; depth++)
         {
-            this->CreateInitialState();
+            slkd::Stack<uint32_t> stack;
+
+            uint32_t root = this->CreateInitialState(observer);
+
+            if (root == NO_PARENT)
+                return false;
 
-            slkd::Stack<graph::Vertex<uint16_t, uint16_t, Vector<State>>*> stack;
+            // Propagation alone may have solved the puzzle
+            if (this->CheckSolution(root, observer))
+            {
+                this->m_solutionNode = root;
+                return true;
+            }
 
-            // The cost of a vertex is the depth in which it was visited (depth of the
-            // search)
-            this->m_graph.GetVertex(0).SetCurrentCost(0);
-            this->m_graph.GetVertex(0).SetLabel(graph::VISITED);
+            // The stack of the previous limit is gone
+            this->m_frontier = 0;
 
-            stack.Push(&this->m_graph.GetVertex(0));
+            stack.Push(root);
+            this->Pushed(root, observer);
+            observer.OnDeepen(depth);
 
             while (not stack.IsEmpty())
             {
-                u = stack.Pop();
+                this->m_phases.Iteration();
+
+                {
+                    phase::Scope pop(this->m_phases, phase::FRONTIER);
+                    u = stack.Pop();
+                    this->Popped(u, observer);
+                }
 
-                // If the cost of the vertex is greater than the depth, we don't need to
+                // If the node is already at the depth limit, we don't need to
                 // expand it (since we are doing a depth-limited search)
-                if (u->GetCurrentCost() > depth)
+                if (this->m_nodes.Node(u).depth >= depth)
+                {
+                    observer.OnBacktrack(
+                        u, this->m_nodes.Node(u).depth, observe::CUTOFF);
+
+                    this->ReleaseNode(u);
                     continue;
+                }
 
-                this->ExpandNode(*u);
+                this->ExpandNode(u, observer);
 
-                // Pair<first, second> = <ID, Edge>
-                for (auto& pair : u->GetAdjacencyList())
+                for (uint32_t v : this->m_children)
                 {
-                    // Edge uv (or vu, if is non-directed uv = vu)
-                    uv = pair.GetSecond();
-
-                    // Get the pointer do neighbor vertex, since one end of the edge is
-                    // vertex u, and the other end is vertex v
-                    uv->GetVertices().GetFirst()->GetID() == u->GetID()
-                        ? v = &this->m_graph.GetVertex(
-                              uv->GetVertices().GetSecond()->GetID())
-                        : v = &this->m_graph.GetVertex(
-                              uv->GetVertices().GetFirst()->GetID());
-
-                    if (this->CheckSolution(*v))
+                    if (this->CheckSolution(v, observer))
                     {
-                        this->m_vertexSolutionID = v->GetID();
+                        this->m_solutionNode = v;
                         return true;
                     }
 
-                    // If the vertex has not been visited yet, we add it to the stack
-                    // with the cost of the current vertex + 1
-                    if (v->GetLabel() == graph::VertexLabel::UNVISITED)
-                    {
-                        v->SetLabel(u->GetCurrentCost() + 1);
-                        stack.Push(v);
-                    }
+                    phase::Scope push(this->m_phases, phase::FRONTIER);
+                    stack.Push(v);
+                    this->Pushed(v, observer);
                 }
 
-                // After expanding a vertex, since we won't visit it again, we remove
-                // the node from the graph to save memory
-                this->m_graph.RemoveVertex(u->GetID());
+                // After expanding a node, since we won't visit it again, we release
+                // its board to save memory
+                this->ReleaseNode(u);
             }
         }
         return false;
     }
 
-    bool Solver::UCS()
+    template<typename Observer>
+    bool Solver::UCS(Observer& observer)
     {
-        // Create the root vertex of the graph
-        this->CreateInitialState();
-
-        bheap::PriorityQueue<
-            graph::Vertex<uint16_t, uint16_t, Vector<State>>*,
-            decltype(graph::compare::Vertex<uint16_t, uint16_t, Vector<State>>)>
+        // Min-heap of priority keys
+        std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>>
             minPQueue;
 
-        // Enqueue the root vertex
-        minPQueue.Enqueue(&this->m_graph.GetVertex(0));
+        uint32_t root = this->CreateInitialState(observer);
+
+        if (root == NO_PARENT)
+            return false;
 
-        // Auxiliar variables to make code most legible
-        graph::Vertex<uint16_t, uint16_t, Vector<State>>* u = nullptr;
-        graph::Vertex<uint16_t, uint16_t, Vector<State>>* v = nullptr;
+        // Propagation alone may have solved the puzzle
+        if (this->CheckSolution(root, observer))
+        {
+            this->m_solutionNode = root;
+            return true;
+        }
 
-        graph::Edge<uint16_t, uint16_t, Vector<State>>* uv;
+        // Enqueue the root node
+        minPQueue.push(this->PriorityKey(root));
+        this->Pushed(root, observer);
 
-        while (not minPQueue.IsEmpty())
+        uint32_t u;
+
+        while (not minPQueue.empty())
         {
-            u = minPQueue.Dequeue();
+            this->m_phases.Iteration();
 
-            u->SetLabel(graph::VertexLabel::VISITED);
+            {
+                phase::Scope pop(this->m_phases, phase::FRONTIER);
+                u = static_cast<uint32_t>(minPQueue.top());
+                minPQueue.pop();
+                this->Popped(u, observer);
+            }
 
-            this->ExpandNode(*u);
+            this->ExpandNode(u, observer);
 
-            // Pair<first, second> = <ID, Edge>
-            for (auto& pair : u->GetAdjacencyList())
+            for (uint32_t v : this->m_children)
             {
-                // Edge uv (or vu, if is non-directed uv = vu)
-                uv = pair.GetSecond();
-
-                // Get the pointer do neighbor vertex, since one end of the edge is
-                // vertex u, and the other end is vertex v
-                uv->GetVertices().GetFirst()->GetID() == u->GetID()
-                    ? v = &this->m_graph.GetVertex(
-                          uv->GetVertices().GetSecond()->GetID())
-                    : v = &this->m_graph.GetVertex(
-                          uv->GetVertices().GetFirst()->GetID());
-
-                if (this->CheckSolution(*v))
+                if (this->CheckSolution(v, observer))
                 {
-                    this->m_vertexSolutionID = v->GetID();
+                    this->m_solutionNode = v;
                     return true;
                 }
 
-                if (v->GetLabel() == graph::VertexLabel::UNVISITED and Relax(u, v, uv))
-                {
-                    minPQueue.Enqueue(v);
-                }
+                SearchNode& node = this->m_nodes.Node(v);
+                node.f           = node.g;
+
+                phase::Scope push(this->m_phases, phase::FRONTIER);
+                minPQueue.push(this->PriorityKey(v));
+                this->Pushed(v, observer);
             }
 
-            // After expanding a vertex, since we won't visit it again, we remove the
-            // node from the graph to save memory
-            this->m_graph.RemoveVertex(u->GetID());
+            // After expanding a node, since we won't visit it again, we release its
+            // board to save memory
+            this->ReleaseNode(u);
         }
         return false;
     }
 
-    bool Solver::AStar()
+    template<typename Observer>
+    bool Solver::AStar(Observer& observer)
     {
-        // Create the root vertex of the graph
-        this->CreateInitialState();
-
-        bheap::PriorityQueue<
-            graph::Vertex<uint16_t, uint16_t, Vector<State>>*,
-            decltype(graph::compare::Vertex<uint16_t, uint16_t, Vector<State>>)>
+        // Min-heap of priority keys
+        std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>>
             minPQueue;
 
-        // Auxiliar variables to make code most legible
-        graph::Vertex<uint16_t, uint16_t, Vector<State>>* u = nullptr;
-        graph::Vertex<uint16_t, uint16_t, Vector<State>>* v = nullptr;
+        uint32_t u = this->CreateInitialState(observer);
 
-        graph::Edge<uint16_t, uint16_t, Vector<State>>* uv;
+        if (u == NO_PARENT)
+            return false;
 
-        u = &this->m_graph.GetVertex(0);
+        // Propagation alone may have solved the puzzle
+        if (this->CheckSolution(u, observer))
+        {
+            this->m_solutionNode = u;
+            return true;
+        }
 
-        uint16_t heuristicCost = this->CalculateAStarHeuristic(*u);
+        uint16_t heuristicCost = this->CalculateAStarHeuristic(u);
 
-        u->SetCurrentCost(heuristicCost);
-        u->SetHeuristicCost(heuristicCost);
+        this->m_nodes.Node(u).h = heuristicCost;
+        this->m_nodes.Node(u).f = heuristicCost;
 
-        minPQueue.Enqueue(u);
+        minPQueue.push(this->PriorityKey(u));
+        this->Pushed(u, observer);
 
-        while (not minPQueue.IsEmpty())
+        while (not minPQueue.empty())
         {
-            u = minPQueue.Dequeue();
+            this->m_phases.Iteration();
 
-            u->SetLabel(graph::VertexLabel::VISITED);
+            {
+                phase::Scope pop(this->m_phases, phase::FRONTIER);
+                u = static_cast<uint32_t>(minPQueue.top());
+                minPQueue.pop();
+                this->Popped(u, observer);
+            }
 
-            this->ExpandNode(*u);
+            this->ExpandNode(u, observer);
 
-            // Pair<first, second> = <ID, Edge>
-            for (auto& pair : u->GetAdjacencyList())
+            for (uint32_t v : this->m_children)
             {
-                // Edge uv (or vu, if is non-directed uv = vu)
-                uv = pair.GetSecond();
-
-                // Get the pointer do neighbor vertex, since one end of the edge
-                // vertex u, and the other end is vertex v
-                uv->GetVertices().GetFirst()->GetID() == u->GetID()
-                    ? v = &this->m_graph.GetVertex(
-                          uv->GetVertices().GetSecond()->GetID())
-                    : v = &this->m_graph.GetVertex(
-                          uv->GetVertices().GetFirst()->GetID());
-
-                if (this->CheckSolution(*v))
+                if (this->CheckSolution(v, observer))
                 {
-                    this->m_vertexSolutionID = v->GetID();
+                    this->m_solutionNode = v;
                     return true;
                 }
 
-                if (v->GetLabel() == graph::VertexLabel::UNVISITED)
-                {
-                    v->SetHeuristicCost(this->CalculateAStarHeuristic(*v));
+                SearchNode& node = this->m_nodes.Node(v);
+                node.h           = this->CalculateAStarHeuristic(v);
+                node.f           = node.g + node.h;
 
-                    if (Relax(u, v, uv))
-                    {
-                        minPQueue.Enqueue(v);
-                    }
-                }
+                phase::Scope push(this->m_phases, phase::FRONTIER);
+                minPQueue.push(this->PriorityKey(v));
+                this->Pushed(v, observer);
             }
 
-            // After expanding a vertex, since we won't visit it again, we remove the
-            // node from the graph to save memory
-            this->m_graph.RemoveVertex(u->GetID());
+            // After expanding a node, since we won't visit it again, we release its
+            // board to save memory
+            this->ReleaseNode(u);
         }
         return false;
     }
 
-    bool Solver::GreedyBFS()
+    template<typename Observer>
+    bool Solver::GreedyBFS(Observer& observer)
     {
-        // Create the root vertex of the graph
-        this->CreateInitialState();
-
-        bheap::PriorityQueue<graph::Vertex<uint16_t, uint16_t, Vector<State>>*,
-                             decltype(graph::compare::VertexHeuristic<uint16_t,
-                                                                      uint16_t,
-                                                                      Vector<State>>)>
+        // Min-heap of priority keys
+        std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>>
             minPQueue;
 
-        // Auxiliar variables to make code most legible
-        graph::Vertex<uint16_t, uint16_t, Vector<State>>* u = nullptr;
-        graph::Vertex<uint16_t, uint16_t, Vector<State>>* v = nullptr;
+        uint32_t u = this->CreateInitialState(observer);
 
-        graph::Edge<uint16_t, uint16_t, Vector<State>>* uv;
+        if (u == NO_PARENT)
+            return false;
+
+        // Propagation alone may have solved the puzzle
+        if (this->CheckSolution(u, observer))
+        {
+            this->m_solutionNode = u;
+            return true;
+        }
 
-        u = &this->m_graph.GetVertex(0);
+        uint16_t heuristicCost = this->CalculateGreedyBFSHeuristic(u);
 
-        uint16_t heuristicCost = this->CalculateGreedyBFSHeuristic(*u);
-        u->SetHeuristicCost(heuristicCost);
+        this->m_nodes.Node(u).h = heuristicCost;
+        this->m_nodes.Node(u).f = heuristicCost;
 
-        minPQueue.Enqueue(u);
+        minPQueue.push(this->PriorityKey(u));
+        this->Pushed(u, observer);
 
-        while (not minPQueue.IsEmpty())
+        while (not minPQueue.empty())
         {
-            u = minPQueue.Dequeue();
+            this->m_phases.Iteration();
 
-            u->SetLabel(graph::VertexLabel::VISITED);
+            {
+                phase::Scope pop(this->m_phases, phase::FRONTIER);
+                u = static_cast<uint32_t>(minPQueue.top());
+                minPQueue.pop();
+                this->Popped(u, observer);
+            }
 
-            this->ExpandNode(*u);
+            this->ExpandNode(u, observer);
 
-            // Pair<first, second> = <ID, Edge>
-            for (auto& pair : u->GetAdjacencyList())
+            for (uint32_t v : this->m_children)
             {
-                // Edge uv (or vu, if is non-directed uv = vu)
-                uv = pair.GetSecond();
-
-                // Get the pointer do neighbor vertex, since one end of the edge
-                // vertex u, and the other end is vertex v
-                uv->GetVertices().GetFirst()->GetID() == u->GetID()
-                    ? v = &this->m_graph.GetVertex(
-                          uv->GetVertices().GetSecond()->GetID())
-                    : v = &this->m_graph.GetVertex(
-                          uv->GetVertices().GetFirst()->GetID());
-
-                if (this->CheckSolution(*v))
+                if (this->CheckSolution(v, observer))
                 {
-                    this->m_vertexSolutionID = v->GetID();
+                    this->m_solutionNode = v;
                     return true;
                 }
 
-                if (v->GetLabel() == graph::VertexLabel::UNVISITED)
-                {
-                    v->SetHeuristicCost(this->CalculateGreedyBFSHeuristic(*v));
+                SearchNode& node = this->m_nodes.Node(v);
+                node.h           = this->CalculateGreedyBFSHeuristic(v);
+                node.f           = node.h;
 
-                    minPQueue.Enqueue(v);
-                }
+                phase::Scope push(this->m_phases, phase::FRONTIER);
+                minPQueue.push(this->PriorityKey(v));
+                this->Pushed(v, observer);
             }
 
-            // After expanding a vertex, since we won't visit it again, we remove the
-            // node from the graph to save memory
-            this->m_graph.RemoveVertex(u->GetID());
+            // After expanding a node, since we won't visit it again, we release its
+            // board to save memory
+            this->ReleaseNode(u);
         }
 
         return false;
     }
 
-    void Solver::PrintAlgorithm()
+    template<typename Observer>
+    bool Solver::Annealing(Observer& observer)
     {
-        std::cout << "Algorithm: ";
+        uint32_t root = this->CreateInitialState(observer);
+
+        if (root == NO_PARENT)
+            return false;
+
+        const grid::Topology& topology = *this->m_options.topology;
+
+        annealing::Annealer annealer(this->m_nodes.Payload(root),
+                                     topology,
+                                     static_cast<uint32_t>(this->m_random()));
+
+        bool solved = annealer.Run(this->m_options.iterations);
 
-        // Print letters according to the algorithm
-        switch (m_algorithm)
+        // Moves are not expansions, so they are counted apart
+        this->m_moves      = annealer.Iterations();
+        this->m_trajectory = annealer.Trajectory();
+
+        if (not solved)
+            return false;
+
+        // Keep the solution as a node, so it is printed like the other engines
+        grid::Board solution;
+        solution.Clear();
+
+        for (uint16_t cell = 0; cell < grid::BOARD_CELLS; cell++)
+        {
+            solution.Set(
+                cell / GRID_SIZE, cell % GRID_SIZE, annealer.Cells()[cell], topology);
+        }
+
+        this->m_nodes.Clear();
+        this->m_solutionNode = this->m_nodes.AddRoot(solution);
+
+        return true;
+    }
+
+    template<typename Observer>
+    bool Solver::ParallelSearch(Observer& observer)
+    {
+        uint32_t root = this->CreateInitialState(observer);
+
+        if (root == NO_PARENT)
+            return false;
+
+        // Propagation alone may have solved the puzzle
+        if (this->CheckSolution(root, observer))
+        {
+            this->m_solutionNode = root;
+            return true;
+        }
+
+        ParallelOptions options = { this->m_options.threads,
+                                    this->m_options.deterministic,
+                                    this->m_options.propagate,
+                                    this->m_options.topology,
+                                    &this->m_progress,
+                                    this->m_options.histograms };
+
+        ParallelDFS search(options);
+
+        bool solved = search.Run(this->m_nodes.Payload(root));
+
+        this->m_expandedStates = search.ExpandedStates();
+        this->m_propagated += search.Propagated();
+        this->m_parallelStats = search.Stats();
+        this->m_shape         = search.Shape();
+
+        if (not solved)
+            return false;
+
+        // Keep the solution as a node, so it is printed like the other engines
+        this->m_nodes.Clear();
+        this->m_solutionNode = this->m_nodes.AddRoot(search.Solution());
+
+        return true;
+    }
+
+    template<typename Observer>
+    bool Solver::Search(Observer& observer)
+    {
+        switch (this->m_algorithm)
         {
             case Algorithm::BFS:
-                std::cout << "BFS" << std::endl;
-                break;
+                return this->BFS(observer);
+
             case Algorithm::IDDFS:
-                std::cout << "IDDFS" << std::endl;
-                break;
+                return this->IDDFS(observer);
+
             case Algorithm::UCS:
-                std::cout << "UCS" << std::endl;
-                break;
+                return this->UCS(observer);
+
             case Algorithm::A_STAR:
-                std::cout << "A*" << std::endl;
-                break;
+                return this->AStar(observer);
+
             case Algorithm::GBFS:
-                std::cout << "GREEDY" << std::endl;
-                break;
+                return this->GreedyBFS(observer);
+
+            case Algorithm::ANNEALING:
+                return this->Annealing(observer);
+
+            case Algorithm::PARALLEL:
+                return this->ParallelSearch(observer);
+
             default:
-                std::cout << "UNKNOWN" << std::endl;
-                break;
+                return false;
+        }
+    }
+
+    const char* AlgorithmName(Algorithm algorithm)
+    {
+        switch (algorithm)
+        {
+            case Algorithm::BFS:
+                return "BFS";
+            case Algorithm::IDDFS:
+                return "IDDFS";
+            case Algorithm::UCS:
+                return "UCS";
+            case Algorithm::A_STAR:
+                return "A*";
+            case Algorithm::GBFS:
+                return "GREEDY";
+            case Algorithm::ANNEALING:
+                return "ANNEALING";
+            case Algorithm::PARALLEL:
+                return "PARALLEL DFS";
+            default:
+                return "UNKNOWN";
+        }
+    }
+
+    void Solver::PrintAlgorithm()
+    {
+        std::cout << "Algorithm: " << AlgorithmName(this->m_algorithm) << std::endl;
+    }
+
+    SolveResult Solver::Run()
+    {
+        SolveResult result = { };
+
+        result.valid =
+            kernel::Active().validate(this->m_startBoard, *this->m_options.topology);
+
+        if (not result.valid)
+            return result;
+
+        this->m_solutionNode   = NO_PARENT;
+        this->m_expandedStates = 0;
+        this->m_expansions     = 0;
+        this->m_moves          = 0;
+        this->m_propagated     = 0;
+        this->m_frontier       = 0;
+        this->m_parallelStats  = ParallelStats { 0, 0, 0, 0, NO_SUBTREE, 0 };
+        this->m_trajectory.clear();
+        this->m_phases.Reset();
+        this->m_series.Start();
+        this->m_progress.Clear();
+        this->m_shape.Clear();
+
+        // Check if the grid is already solved
+        if (grid::IsSolved(this->m_startBoard))
+        {
+            result.solved = true;
+            grid::CopyGrid(this->m_startBoard, result.solution);
+            return result;
+        }
+
+        trace::Span span(AlgorithmName(this->m_algorithm), "solve");
+
+        std::optional<perf::CounterGroup> counters;
+
+        // Opened before the clock starts, since it takes a system call per event.
+        // Only on request, so a plain solve opens no file descriptor
+        if (this->m_options.perfCounters)
+            counters.emplace();
+
+        // Only the tree searches are logged: the local search draws a random move
+        // per iteration and the parallel search depends on timing
+        std::optional<searchlog::Log> recording;
+
+        bool tree = this->m_algorithm != Algorithm::ANNEALING and
+                    this->m_algorithm != Algorithm::PARALLEL;
+
+        this->m_log = tree ? this->m_options.replay : nullptr;
+
+        if (tree and this->m_log == nullptr and this->m_options.record != nullptr)
+        {
+            recording.emplace(this->m_options.record, this->LogHeader());
+
+            if (recording->IsOpen())
+                this->m_log = &*recording;
+            else
+                std::cerr << "Could not write " << this->m_options.record << std::endl;
+        }
+
+        std::optional<progress::Heartbeat> heartbeat;
+
+        if (this->m_options.heartbeat.periodNs > 0)
+            heartbeat.emplace(this->m_progress,
+                              this->m_options.heartbeat,
+                              AlgorithmName(this->m_algorithm));
+
+        // The loops without instruments are a separate instantiation, taken when
+        // nothing observes the search. The semaphores of the USDT probes are read
+        // once here, so a tracer attached in the middle of a search sees the
+        // probes of the loops from the next search on
+        observe::Instruments instruments(
+            this->m_nodes,
+            *this->m_options.topology,
+            this->m_progress,
+            this->m_series,
+            this->m_burst,
+            this->m_log,
+            this->m_options.histograms ? &this->m_shape : nullptr,
+            this->m_options.memory ? &result.memory : nullptr);
+
+        bool observed = observe::ProbesAttached() or this->m_log != nullptr or
+                        heartbeat or this->m_series.IsEnabled() or
+                        trace::IsEnabled() or this->m_options.histograms or
+                        this->m_options.memory;
+
+        if (this->m_options.memory)
+            result.memory.rssBefore = memory::PeakRss();
+
+        alloc::Tracker allocations;
+
+        SUDOKU_PROBE2(solve__start,
+                      static_cast<char>(this->m_algorithm),
+                      this->m_options.threads);
+
+        auto start = std::chrono::steady_clock::now();
+
+        if (counters)
+            counters->Start();
+
+        if (observed)
+        {
+            result.solved = this->Search(instruments);
         }
+        else
+        {
+            observe::NullObserver none;
+            result.solved = this->Search(none);
+        }
+
+        if (counters)
+            counters->Stop();
+
+        auto end = std::chrono::steady_clock::now();
+
+        SUDOKU_PROBE4(solve__end,
+                      static_cast<char>(this->m_algorithm),
+                      result.solved,
+                      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                          .count(),
+                      this->m_expandedStates);
+
+        this->m_burst.Close();
+        heartbeat.reset();
+
+        if (this->m_log != nullptr)
+        {
+            this->m_log->Event(searchlog::END, result.solved);
+            this->m_log = nullptr;
+        }
+
+        // Writes the last block, outside of the timed region
+        recording.reset();
+
+        if (result.solved)
+        {
+            grid::CopyGrid(this->m_nodes.Payload(this->m_solutionNode),
+                           result.solution);
+        }
+
+        result.nanoseconds =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        result.expandedStates = this->m_expandedStates;
+        result.expansions     = this->m_expansions;
+        result.moves          = this->m_moves;
+        result.propagated     = this->m_propagated;
+        result.parallel       = this->m_parallelStats;
+        result.phases         = this->m_phases.Read();
+
+        if (counters)
+            result.counters = counters->Read();
+
+        result.allocations = allocations.Read();
+
+        // The local and parallel searches keep no open list of their own
+        if (this->m_algorithm != Algorithm::ANNEALING and
+            this->m_algorithm != Algorithm::PARALLEL)
+        {
+            this->m_series.Finish(this->m_expansions,
+                                  this->m_frontier,
+                                  this->m_nodes.LiveNodes(),
+                                  this->m_nodes.Bytes());
+        }
+
+        result.series = this->m_series.Samples();
+        result.peaks  = this->m_series.HighWater();
+        result.shape  = this->m_shape;
+
+        // The children of the last expansion were added after its sample
+        if (this->m_options.memory)
+        {
+            instruments.Account();
+            this->AccountMemory(result.memory);
+        }
+
+        span.Argument("expanded", result.expandedStates);
+
+        return result;
     }
 
-    void Solver::Solve()
+    SolveResult Solver::Solve()
     {
-        if (not grid::GridIsValid(this->m_startGrid))
+        if (not grid::GridIsValid(this->m_startBoard, *this->m_options.topology))
         {
             std::cout << "Invalid grid t(-_-t)" << std::endl;
             grid::PrintGrid(this->m_startGrid);
-            return;
+            return SolveResult { };
         }
 
         std::cout << "Solving the following grid:" << std::endl;
         grid::PrintGrid(this->m_startGrid);
         std::cout << std::endl;
 
-        bool solved = false;
-
-        // Get total time in milliseconds
-        auto start = std::chrono::high_resolution_clock::now();
-
         // Check if the grid is already solved
         if (grid::IsSolved(this->m_startGrid))
         {
             grid::PrintGrid(this->m_startGrid);
-            return;
+            return this->Run();
+        }
+
+        SolveResult result = this->Run();
+
+        if (result.solved)
+        {
+            std::cout << "Solution found :')\n" << std::endl;
+
+            this->PrintState(this->m_solutionNode);
         }
         else
         {
-            switch (this->m_algorithm)
-            {
-                case Algorithm::BFS:
-                    solved = this->BFS();
-                    break;
+            std::cout << "No solution found :(\n" << std::endl;
+        }
 
-                case Algorithm::IDDFS:
-                    solved = this->IDDFS();
-                    break;
+        // Show algorithm used
+        this->PrintAlgorithm();
 
-                case Algorithm::UCS:
-                    solved = this->UCS();
-                    break;
+        std::cout << "Total time: " << result.nanoseconds / 1000000 << " ms"
+                  << std::endl;
+        std::cout << "Total expanded states: " << this->m_expandedStates << std::endl;
 
-                case Algorithm::A_STAR:
-                    solved = this->AStar();
-                    break;
+        if (this->m_options.propagate)
+            std::cout << "Total propagated cells: " << this->m_propagated << std::endl;
 
-                case Algorithm::GBFS:
-                    solved = this->GreedyBFS();
-                    break;
+        if (this->m_algorithm == Algorithm::ANNEALING)
+        {
+            std::cout << "Total moves: " << this->m_moves << std::endl;
+            std::cout << "Conflict trajectory:";
 
-                default:
-                    break;
+            for (const annealing::Sample& sample : this->m_trajectory)
+            {
+                std::cout << " " << sample.iteration << ":" << sample.conflicts;
             }
+
+            std::cout << std::endl;
         }
 
-        auto end = std::chrono::high_resolution_clock::now();
+        if (this->m_algorithm == Algorithm::PARALLEL)
+        {
+            const ParallelStats& stats = this->m_parallelStats;
+
+            std::cout << "Threads: " << this->m_options.threads
+                      << (this->m_options.deterministic ? " (deterministic)" : "")
+                      << std::endl;
+            std::cout << "Subtrees: " << stats.subtrees
+                      << ", searched: " << stats.searched << ", winner: ";
+
+            if (stats.winner == NO_SUBTREE)
+                std::cout << "none";
+            else
+                std::cout << stats.winner;
+
+            std::cout << std::endl;
+            std::cout << "Off home: " << stats.offHome
+                      << ", contention: " << stats.contention << std::endl;
+        }
 
-        if (solved)
+        std::cout << "Kernel (propagation and validation): " << kernel::Active().name
+                  << std::endl;
+
+        if (this->m_options.perfCounters)
         {
-            std::cout << "Solution found :')\n" << std::endl;
+            std::cout << "Cache misses per expansion: ";
 
-            this->PrintState(this->m_graph.GetVertices().At(this->m_vertexSolutionID));
+            if (result.counters.available[perf::L1D_MISSES] and this->m_expansions > 0)
+            {
+                std::cout << static_cast<double>(
+                                 result.counters.values[perf::L1D_MISSES]) /
+                                 static_cast<double>(this->m_expansions)
+                          << std::endl;
+            }
+            else
+            {
+                std::cout << "unavailable" << std::endl;
+            }
         }
-        else
+
+        if (result.phases.enabled and result.phases.iterations > 0)
+            this->PrintPhases(result);
+
+        if (result.allocations.enabled)
+            this->PrintAllocations(result);
+
+        if (not result.series.empty())
+            this->PrintSeries(result);
+
+        if (this->m_options.histograms and result.shape.Depths() > 0)
+            this->PrintShape(result);
+
+        if (result.memory.enabled)
+            this->PrintMemory(result);
+
+        return result;
+    }
+
+    void Solver::AccountMemory(memory::Usage& usage)
+    {
+        // BFS and IDDFS keep linked lists of indices, the others heaps of keys
+        std::size_t entry = this->m_algorithm == Algorithm::BFS or
+                                    this->m_algorithm == Algorithm::IDDFS
+                                ? memory::LINK_BYTES
+                                : memory::KEY_BYTES;
+
+        // Arrays never shrink during a search, so their capacity is their peak
+        usage.enabled                     = true;
+        usage.reserved[memory::NODES]     = this->m_nodes.NodeBytes();
+        usage.reserved[memory::BOARDS]    = this->m_nodes.PayloadBytes();
+        usage.reserved[memory::FREE_LIST] = this->m_nodes.FreeListBytes();
+
+        // The containers of the open list are gone, only their largest size is left
+        usage.bytes[memory::FRONTIER]    = usage.frontier * entry;
+        usage.reserved[memory::FRONTIER] = usage.bytes[memory::FRONTIER];
+
+        // A reused buffer, sized for the children of one expansion
+        std::size_t children = this->m_children.capacity() * sizeof(uint32_t);
+
+        usage.bytes[memory::CHILDREN]    = children;
+        usage.reserved[memory::CHILDREN] = children;
+
+        usage.rssAfter = memory::PeakRss();
+    }
+
+    void Solver::PrintMemory(const SolveResult& result)
+    {
+        std::cout << "\nMemory:" << std::endl;
+        memory::Print(result.memory);
+    }
+
+    void Solver::PrintShape(const SolveResult& result)
+    {
+        std::cout << "\nTree shape:" << std::endl;
+        shape::Print(result.shape);
+    }
+
+    void Solver::PrintSeries(const SolveResult& result)
+    {
+        std::cout << "\nHigh water (" << this->m_series.Taken()
+                  << " samples): frontier " << result.peaks.frontier
+                  << ", live nodes " << result.peaks.liveNodes << ", arena bytes "
+                  << result.peaks.arenaBytes << std::endl;
+
+        if (this->m_options.seriesFile == nullptr)
+            return;
+
+        if (not series::Dump(this->m_options.seriesFile,
+                             AlgorithmName(this->m_algorithm),
+                             result.series))
+            std::cerr << "Could not write " << this->m_options.seriesFile << std::endl;
+    }
+
+    void Solver::PrintAllocations(const SolveResult& result)
+    {
+        const alloc::Stats& stats = result.allocations;
+
+        std::cout << "\nAllocations: " << stats.total.allocations << " ("
+                  << std::fixed << std::setprecision(2)
+                  << static_cast<double>(stats.total.allocations) /
+                         std::max<std::size_t>(result.expandedStates, 1)
+                  << " per expanded state), frees: " << stats.total.frees
+                  << ", bytes: " << stats.total.bytes
+                  << ", peak live bytes: " << stats.peakLive << std::defaultfloat
+                  << std::endl;
+        std::cout << std::left << std::setw(12) << "phase" << std::right
+                  << std::setw(14) << "allocations" << std::setw(12) << "frees"
+                  << std::setw(14) << "bytes" << std::endl;
+
+        for (std::size_t slot = 0; slot < alloc::SLOTS; slot++)
         {
-            std::cout << "No solution found :(\n" << std::endl;
+            const alloc::Counts& counts = stats.phases[slot];
+
+            if (counts.allocations == 0 and counts.frees == 0)
+                continue;
+
+            const char* name = slot == alloc::NO_PHASE
+                                   ? "other"
+                                   : phase::PhaseName(static_cast<phase::Phase>(slot));
+
+            std::cout << std::left << std::setw(12) << name << std::right
+                      << std::setw(14) << counts.allocations << std::setw(12)
+                      << counts.frees << std::setw(14) << counts.bytes << std::endl;
         }
+    }
 
-        // Show algorithm used
-        this->PrintAlgorithm();
+    void Solver::PrintPhases(const SolveResult& result)
+    {
+        const phase::Breakdown& phases = result.phases;
+        uint64_t                other  = result.nanoseconds;
 
-        std::cout << "Total time: "
-                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - start)
-                         .count()
-                  << " ms" << std::endl;
-        std::cout << "Total expanded states: " << this->m_expandedStates << std::endl;
+        std::cout << "\nPhases (" << phases.sampled << " of " << phases.iterations
+                  << " iterations timed):" << std::endl;
+        std::cout << std::left << std::setw(12) << "phase" << std::right
+                  << std::setw(12) << "calls" << std::setw(12) << "time (ms)"
+                  << std::setw(8) << "share" << std::endl;
+
+        for (std::size_t i = 0; i <= phase::PHASES; i++)
+        {
+            uint64_t    nanoseconds = other;
+            uint64_t    calls       = phases.iterations;
+            const char* name        = "other";
+
+            if (i < phase::PHASES)
+            {
+                nanoseconds = phases.nanoseconds[i];
+                calls       = phases.calls[i];
+                name        = phase::PhaseName(static_cast<phase::Phase>(i));
+                other -= std::min(other, nanoseconds);
+            }
+
+            std::cout << std::left << std::setw(12) << name << std::right
+                      << std::setw(12) << calls << std::setw(12) << std::fixed
+                      << std::setprecision(3) << nanoseconds / 1e6 << std::setw(7)
+                      << std::setprecision(1)
+                      << 100.0 * nanoseconds / std::max<uint64_t>(result.nanoseconds, 1)
+                      << "%" << std::defaultfloat << std::endl;
+        }
     }
 } // namespace sudoku
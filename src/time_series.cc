@@ -0,0 +1,212 @@
+/*
+ * Filename: time_series.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "time_series.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace series
+{
+    Recorder::Recorder(const Interval& interval)
+        : m_interval(interval)
+    {
+        // Allocated once, so sampling never hits the allocator
+        if (this->IsEnabled())
+            this->m_samples.resize(CAPACITY);
+
+        this->Start();
+    }
+
+    Recorder::~Recorder() { }
+
+    void Recorder::Start()
+    {
+        this->m_head  = 0;
+        this->m_count = 0;
+        this->m_taken = 0;
+        this->m_peaks = Peaks { 0, 0, 0 };
+        this->m_last  = Sample { 0, 0, 0, 0, 0, 0 };
+        this->m_start = Clock::now();
+
+        if (this->m_interval.expansions > 0)
+            this->m_next = this->m_interval.expansions;
+        else if (this->m_interval.periodNs > 0)
+            this->m_next = CLOCK_STRIDE;
+        else
+            this->m_next = UINT64_MAX;
+    }
+
+    void Recorder::Record(uint64_t expansions,
+                          uint64_t frontier,
+                          uint64_t liveNodes,
+                          uint64_t arenaBytes)
+    {
+        uint64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   Clock::now() - this->m_start)
+                                   .count();
+
+        if (this->m_interval.expansions > 0)
+        {
+            this->m_next = expansions + this->m_interval.expansions;
+        }
+        else
+        {
+            // Sampling by time reads the clock every CLOCK_STRIDE expansions, and
+            // only keeps a sample once the period has passed
+            this->m_next = expansions + CLOCK_STRIDE;
+
+            if (nanoseconds - this->m_last.nanoseconds < this->m_interval.periodNs)
+                return;
+        }
+
+        uint64_t elapsed = nanoseconds - this->m_last.nanoseconds;
+        Sample   sample  = {
+            nanoseconds, expansions, frontier, liveNodes, arenaBytes, 0
+        };
+
+        if (elapsed > 0)
+            sample.rate = 1e9 * (expansions - this->m_last.expansions) / elapsed;
+
+        this->m_samples[this->m_head] = sample;
+        this->m_head                  = (this->m_head + 1) % CAPACITY;
+        this->m_count                 = std::min(this->m_count + 1, CAPACITY);
+        this->m_last                  = sample;
+        this->m_taken++;
+
+        this->m_peaks.frontier   = std::max(this->m_peaks.frontier, frontier);
+        this->m_peaks.liveNodes  = std::max(this->m_peaks.liveNodes, liveNodes);
+        this->m_peaks.arenaBytes = std::max(this->m_peaks.arenaBytes, arenaBytes);
+    }
+
+    void Recorder::Finish(uint64_t expansions,
+                          uint64_t frontier,
+                          uint64_t liveNodes,
+                          uint64_t arenaBytes)
+    {
+        if (not this->IsEnabled())
+            return;
+
+        // Take the sample even if the period has not passed
+        Interval interval           = this->m_interval;
+        this->m_interval.expansions = 1;
+
+        this->Record(expansions, frontier, liveNodes, arenaBytes);
+
+        this->m_interval = interval;
+        this->m_next     = UINT64_MAX;
+    }
+
+    std::vector<Sample> Recorder::Samples() const
+    {
+        std::vector<Sample> samples;
+        samples.reserve(this->m_count);
+
+        // Until the buffer wraps, the oldest sample is in the first slot
+        std::size_t first = (this->m_head + CAPACITY - this->m_count) % CAPACITY;
+
+        for (std::size_t i = 0; i < this->m_count; i++)
+        {
+            samples.push_back(this->m_samples[(first + i) % CAPACITY]);
+        }
+
+        return samples;
+    }
+
+    bool ParseInterval(const char* text, Interval& interval)
+    {
+        char*    end;
+        uint64_t value = std::strtoull(text, &end, 10);
+
+        if (end == text or value == 0)
+            return false;
+
+        interval = Interval();
+
+        if (std::strcmp(end, "ms") == 0)
+        {
+            interval.periodNs = value * 1000000;
+            return true;
+        }
+
+        interval.expansions = value;
+
+        return *end == '\0';
+    }
+
+    bool Dump(const char*                path,
+              const char*                algorithm,
+              const std::vector<Sample>& samples)
+    {
+        // Solves dumped by this process
+        static std::size_t solves = 0;
+
+        std::size_t length = std::strlen(path);
+        std::FILE*  file   = std::fopen(path, solves == 0 ? "w" : "a");
+
+        bool json = length >= 5 and std::strcmp(path + length - 5, ".json") == 0;
+
+        if (file == nullptr)
+            return false;
+
+        if (json)
+        {
+            std::fprintf(file,
+                         "{\"solve\":%zu,\"algorithm\":\"%s\",\"samples\":[",
+                         solves,
+                         algorithm);
+
+            for (std::size_t i = 0; i < samples.size(); i++)
+            {
+                const Sample& sample = samples[i];
+
+                std::fprintf(file,
+                             "%s{\"ns\":%" PRIu64 ",\"expansions\":%" PRIu64
+                             ",\"frontier\":%" PRIu64 ",\"live_nodes\":%" PRIu64
+                             ",\"arena_bytes\":%" PRIu64
+                             ",\"expansions_per_second\":%.1f}",
+                             i == 0 ? "" : ",",
+                             sample.nanoseconds,
+                             sample.expansions,
+                             sample.frontier,
+                             sample.liveNodes,
+                             sample.arenaBytes,
+                             sample.rate);
+            }
+
+            std::fprintf(file, "]}\n");
+        }
+        else
+        {
+            if (solves == 0)
+                std::fprintf(file,
+                             "solve,algorithm,ns,expansions,frontier,live_nodes,"
+                             "arena_bytes,expansions_per_second\n");
+
+            for (const Sample& sample : samples)
+            {
+                std::fprintf(file,
+                             "%zu,%s,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64
+                             ",%" PRIu64 ",%.1f\n",
+                             solves,
+                             algorithm,
+                             sample.nanoseconds,
+                             sample.expansions,
+                             sample.frontier,
+                             sample.liveNodes,
+                             sample.arenaBytes,
+                             sample.rate);
+            }
+        }
+
+        solves++;
+
+        return std::fclose(file) == 0;
+    }
+} // namespace series
@@ -0,0 +1,66 @@
+/*
+ * Filename: topology.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "topology.h"
+
+#include <cstring>
+
+namespace grid
+{
+    bool MakeJigsaw(const char* regions, Topology& topology)
+    {
+        uint8_t size[GRID_SIZE] = { };
+
+        topology            = Topology { };
+        topology.name       = "jigsaw";
+        topology.extraCount = 0;
+
+        for (std::size_t cell = 0; cell < BOARD_CELLS; cell++)
+        {
+            uint8_t region = regions[cell] - '1';
+
+            if (region >= GRID_SIZE)
+                return false;
+
+            topology.region[cell] = region;
+            size[region]++;
+        }
+
+        for (std::size_t region = 0; region < GRID_SIZE; region++)
+        {
+            if (size[region] != GRID_SIZE)
+                return false;
+        }
+
+        FinishTopology(topology);
+
+        return true;
+    }
+
+    const Topology* FindTopology(const char* name, Topology& custom)
+    {
+        const char* jigsaw = "jigsaw:";
+
+        if (std::strcmp(name, CLASSIC.name) == 0)
+            return &CLASSIC;
+
+        if (std::strcmp(name, DIAGONAL.name) == 0)
+            return &DIAGONAL;
+
+        if (std::strcmp(name, WINDOKU.name) == 0)
+            return &WINDOKU;
+
+        if (std::strncmp(name, jigsaw, std::strlen(jigsaw)) == 0)
+        {
+            const char* regions = name + std::strlen(jigsaw);
+
+            if (std::strlen(regions) == BOARD_CELLS and MakeJigsaw(regions, custom))
+                return &custom;
+        }
+
+        return nullptr;
+    }
+} // namespace grid
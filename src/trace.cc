@@ -0,0 +1,239 @@
+/*
+ * Filename: trace.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "trace.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace trace
+{
+    std::atomic<bool> g_enabled(false);
+
+    /**
+     * @brief Event waiting to be written
+     */
+    struct Event
+    {
+        const char* name;     /**< Name of the event */
+        const char* category; /**< Category of the event */
+        const char* argument; /**< Name of the argument, or nullptr */
+        uint64_t    value;    /**< Value of the argument */
+        uint64_t    start;    /**< Nanoseconds since the start of the session */
+        uint64_t    duration; /**< Length of a span, 0 for an instant */
+        char        phase;    /**< 'X' for a span, 'i' for an instant */
+    };
+
+    /**
+     * @brief Events of a thread. Only the owner appends to it
+     */
+    struct Buffer
+    {
+        std::size_t        tid;     /**< Id of the thread in the trace */
+        std::string        name;    /**< Name of the thread, may be empty */
+        std::vector<Event> events;  /**< Events in recording order */
+        uint64_t           dropped; /**< Events past MAX_EVENTS */
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    static Clock::time_point                    s_origin;  /**< Start of the session */
+    static std::mutex                           s_mutex;   /**< Guards s_buffers */
+    static std::vector<std::unique_ptr<Buffer>> s_buffers; /**< One per thread */
+
+    // Kept by s_buffers, so the events outlive the thread that recorded them
+    static thread_local Buffer* t_buffer = nullptr;
+
+    /**
+     * @brief Get the buffer of the calling thread, registering it on first use
+     * @return Buffer of the thread
+     **/
+    static Buffer& ThreadBuffer()
+    {
+        if (t_buffer == nullptr)
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+
+            s_buffers.push_back(std::make_unique<Buffer>());
+
+            t_buffer          = s_buffers.back().get();
+            t_buffer->tid     = s_buffers.size();
+            t_buffer->dropped = 0;
+            t_buffer->events.reserve(4096);
+        }
+
+        return *t_buffer;
+    }
+
+    /**
+     * @brief Append an event to the buffer of the calling thread
+     * @param event Event to append
+     **/
+    static void Append(const Event& event)
+    {
+        Buffer& buffer = ThreadBuffer();
+
+        if (buffer.events.size() < MAX_EVENTS)
+            buffer.events.push_back(event);
+        else
+            buffer.dropped++;
+    }
+
+    uint64_t Now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                                    s_origin)
+            .count();
+    }
+
+    void Complete(const char* name,
+                  const char* category,
+                  uint64_t    start,
+                  const char* argument,
+                  uint64_t    value)
+    {
+        uint64_t end = Now();
+
+        Append(Event { name, category, argument, value, start, end - start, 'X' });
+    }
+
+    void Instant(const char* name,
+                 const char* category,
+                 const char* argument,
+                 uint64_t    value)
+    {
+        if (not IsEnabled())
+            return;
+
+        Append(Event { name, category, argument, value, Now(), 0, 'i' });
+    }
+
+    void NameThread(const char* name, std::size_t index)
+    {
+        if (not IsEnabled())
+            return;
+
+        ThreadBuffer().name = std::string(name) + " " + std::to_string(index);
+    }
+
+    /**
+     * @brief Write the events of every thread
+     * @param file Destination
+     * @return Number of events dropped because a buffer was full
+     **/
+    static uint64_t WriteEvents(std::FILE* file)
+    {
+        int      pid     = getpid();
+        uint64_t dropped = 0;
+        bool     first   = true;
+
+        std::fprintf(file, "{\"traceEvents\":[\n");
+
+        for (const std::unique_ptr<Buffer>& buffer : s_buffers)
+        {
+            dropped += buffer->dropped;
+
+            if (not buffer->name.empty())
+            {
+                std::fprintf(file,
+                             "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+                             "\"tid\":%zu,\"args\":{\"name\":\"%s\"}}",
+                             first ? "" : ",\n",
+                             pid,
+                             buffer->tid,
+                             buffer->name.c_str());
+                first = false;
+            }
+
+            for (const Event& event : buffer->events)
+            {
+                // Timestamps are in microseconds
+                std::fprintf(file,
+                             "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\","
+                             "\"ts\":%.3f,\"pid\":%d,\"tid\":%zu",
+                             first ? "" : ",\n",
+                             event.name,
+                             event.category,
+                             event.phase,
+                             event.start / 1e3,
+                             pid,
+                             buffer->tid);
+                first = false;
+
+                if (event.phase == 'X')
+                    std::fprintf(file, ",\"dur\":%.3f", event.duration / 1e3);
+                else
+                    std::fprintf(file, ",\"s\":\"t\"");
+
+                if (event.argument != nullptr)
+                    std::fprintf(file,
+                                 ",\"args\":{\"%s\":%" PRIu64 "}",
+                                 event.argument,
+                                 event.value);
+
+                std::fprintf(file, "}");
+            }
+        }
+
+        std::fprintf(file,
+                     "\n],\"displayTimeUnit\":\"ns\","
+                     "\"otherData\":{\"dropped\":%" PRIu64 "}}\n",
+                     dropped);
+
+        return dropped;
+    }
+
+    Session::Session(const char* path)
+        : m_path(path)
+    {
+        if (this->m_path == nullptr)
+            return;
+
+        s_origin = Clock::now();
+        g_enabled.store(true, std::memory_order_relaxed);
+
+        NameThread("main", 0);
+    }
+
+    Session::~Session()
+    {
+        if (this->m_path == nullptr)
+            return;
+
+        g_enabled.store(false, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+        std::FILE*                  file = std::fopen(this->m_path, "w");
+
+        if (file == nullptr)
+        {
+            std::fprintf(stderr, "Could not write the trace to %s\n", this->m_path);
+            return;
+        }
+
+        uint64_t dropped = WriteEvents(file);
+
+        std::fclose(file);
+
+        if (dropped > 0)
+            std::fprintf(stderr,
+                         "Trace buffers full, %" PRIu64 " events dropped\n",
+                         dropped);
+
+        for (const std::unique_ptr<Buffer>& buffer : s_buffers)
+        {
+            buffer->events.clear();
+            buffer->dropped = 0;
+        }
+    }
+} // namespace trace
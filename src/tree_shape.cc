@@ -0,0 +1,80 @@
+/*
+ * Filename: tree_shape.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "tree_shape.h"
+
+#include <cstdio>
+
+namespace shape
+{
+    void Histograms::Clear()
+    {
+        *this = Histograms { };
+    }
+
+    void Histograms::Merge(const Histograms& other)
+    {
+        for (std::size_t depth = 0; depth < DEPTHS; depth++)
+        {
+            this->nodes[depth] += other.nodes[depth];
+            this->children[depth] += other.children[depth];
+            this->deadEnds[depth] += other.deadEnds[depth];
+        }
+
+        for (std::size_t width = 0; width < WIDTHS; width++)
+        {
+            this->candidates[width] += other.candidates[width];
+        }
+    }
+
+    std::size_t Histograms::Depths() const
+    {
+        std::size_t depths = DEPTHS;
+
+        while (depths > 0 and this->nodes[depths - 1] == 0)
+        {
+            depths--;
+        }
+
+        return depths;
+    }
+
+    void Print(const Histograms& histograms, std::size_t runs)
+    {
+        double divisor = std::max<std::size_t>(runs, 1);
+
+        std::printf("%6s %14s %14s %10s %12s\n",
+                    "depth",
+                    "nodes",
+                    "children",
+                    "branching",
+                    "dead_ends");
+
+        // Depths without nodes are skipped, propagation may jump over several
+        for (std::size_t depth = 0; depth < histograms.Depths(); depth++)
+        {
+            if (histograms.nodes[depth] == 0)
+                continue;
+
+            std::printf("%6zu %14.1f %14.1f %10.3f %12.1f\n",
+                        depth,
+                        histograms.nodes[depth] / divisor,
+                        histograms.children[depth] / divisor,
+                        histograms.Branching(depth),
+                        histograms.deadEnds[depth] / divisor);
+        }
+
+        std::printf("Candidates of the chosen cell:");
+
+        for (std::size_t width = 0; width < WIDTHS; width++)
+        {
+            if (histograms.candidates[width] > 0)
+                std::printf(" %zu:%.1f", width, histograms.candidates[width] / divisor);
+        }
+
+        std::printf("\n");
+    }
+} // namespace shape
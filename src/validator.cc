@@ -0,0 +1,139 @@
+/*
+ * Filename: validator.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "validator.h"
+
+#include <algorithm>
+
+#include "kernels.h"
+
+namespace validator
+{
+    /**
+     * @brief Scan a rejected grid and record every offending cell
+     * @param grid Packed grid
+     * @param index Index of the grid in the batch
+     * @param solutions If true, empty cells are errors
+     * @param topology Topology of the grid
+     * @param errors Receives the errors found
+     **/
+    static void LocateErrors(const uint8_t*        grid,
+                             uint32_t              index,
+                             bool                  solutions,
+                             const grid::Topology& topology,
+                             std::vector<Error>&   errors)
+    {
+        for (uint16_t cell = 0; cell < grid::BOARD_CELLS; cell++)
+        {
+            uint8_t num = grid[cell];
+            uint8_t pos = static_cast<uint8_t>(cell);
+
+            if (num > GRID_SIZE)
+            {
+                errors.push_back({ index, pos, Reason::BAD_CHARACTER });
+                continue;
+            }
+
+            if (num == 0)
+            {
+                if (solutions)
+                    errors.push_back({ index, pos, Reason::EMPTY_CELL });
+
+                continue;
+            }
+
+            // Only the later cell of a repeated pair is reported, against the
+            // first earlier peer holding the same number
+            for (uint8_t i = 0; i < topology.peerCount[cell]; i++)
+            {
+                uint8_t peer = topology.peers[cell][i];
+
+                if (peer > cell)
+                    break;
+
+                if (grid[peer] != num)
+                    continue;
+
+                Reason reason = peer / GRID_SIZE == cell / GRID_SIZE
+                                    ? Reason::DUPLICATE_ROW
+                                : peer % GRID_SIZE == cell % GRID_SIZE
+                                    ? Reason::DUPLICATE_COL
+                                : topology.region[peer] == topology.region[cell]
+                                    ? Reason::DUPLICATE_BOX
+                                    : Reason::DUPLICATE_EXTRA;
+
+                errors.push_back({ index, pos, reason });
+                break;
+            }
+        }
+    }
+
+    const char* ReasonName(Reason reason)
+    {
+        switch (reason)
+        {
+            case Reason::BAD_CHARACTER:
+                return "invalid character";
+            case Reason::BAD_LENGTH:
+                return "wrong number of cells";
+            case Reason::EMPTY_CELL:
+                return "empty cell in solution";
+            case Reason::DUPLICATE_ROW:
+                return "number repeated in row";
+            case Reason::DUPLICATE_COL:
+                return "number repeated in column";
+            case Reason::DUPLICATE_BOX:
+                return "number repeated in box";
+            case Reason::DUPLICATE_EXTRA:
+                return "number repeated in diagonal or window";
+            default:
+                return "unknown";
+        }
+    }
+
+    std::size_t Validate(const uint8_t*        cells,
+                         std::size_t           count,
+                         bool                  solutions,
+                         const grid::Topology& topology,
+                         std::vector<Error>&   errors)
+    {
+        const kernel::Kernels& kernels = kernel::Active();
+
+        uint8_t     valid[BATCH_SIZE];
+        std::size_t invalid = 0;
+
+        // Work in batches that fit in the L2, so the rescan of rejected grids hits
+        // the cache
+        for (std::size_t first = 0; first < count; first += BATCH_SIZE)
+        {
+            std::size_t size   = std::min(BATCH_SIZE, count - first);
+            std::size_t blocks = (size + kernel::LANES - 1) / kernel::LANES;
+
+            kernels.validateMany(
+                cells + Offset(first, 0), blocks, solutions, topology, valid);
+
+            for (std::size_t i = 0; i < size; i++)
+            {
+                if (valid[i])
+                    continue;
+
+                // Gather the rejected grid back into row-major order
+                uint32_t index = static_cast<uint32_t>(first + i);
+                uint8_t  grid[grid::BOARD_CELLS];
+
+                for (std::size_t cell = 0; cell < grid::BOARD_CELLS; cell++)
+                {
+                    grid[cell] = cells[Offset(index, cell)];
+                }
+
+                LocateErrors(grid, index, solutions, topology, errors);
+                invalid++;
+            }
+        }
+
+        return invalid;
+    }
+} // namespace validator
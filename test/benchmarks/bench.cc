@@ -0,0 +1,405 @@
+/*
+ * Filename: bench.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "bench.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include "board.h"
+#include "grid_utils.h"
+#include "kernels.h"
+
+namespace bench
+{
+    /**
+     * @brief Get the median of some samples
+     * @param samples Samples, reordered in place
+     * @return Median, or zero if there are no samples
+     **/
+    static double Median(std::vector<double>& samples)
+    {
+        if (samples.empty())
+            return 0;
+
+        std::sort(samples.begin(), samples.end());
+
+        std::size_t middle = samples.size() / 2;
+
+        if (samples.size() % 2 == 1)
+            return samples[middle];
+
+        return (samples[middle - 1] + samples[middle]) / 2;
+    }
+
+    /**
+     * @brief Get a percentile of sorted samples by the nearest-rank method
+     * @param sorted Samples in increasing order, at least one
+     * @param fraction Percentile as a fraction, in (0, 1]
+     * @return Smallest sample with at least that fraction of the samples below or at
+     * it
+     **/
+    static double Percentile(const std::vector<double>& sorted, double fraction)
+    {
+        std::size_t rank = std::ceil(fraction * sorted.size());
+
+        return sorted[std::max<std::size_t>(rank, 1) - 1];
+    }
+
+    Summary Summarize(std::vector<double> samples)
+    {
+        Summary summary = { 0, 0, 0, 0 };
+
+        if (samples.empty())
+            return summary;
+
+        summary.median = Median(samples);
+        summary.p90    = Percentile(samples, 0.90);
+        summary.p99    = Percentile(samples, 0.99);
+
+        std::vector<double> deviations;
+        deviations.reserve(samples.size());
+
+        for (double sample : samples)
+        {
+            deviations.push_back(std::fabs(sample - summary.median));
+        }
+
+        summary.mad = Median(deviations);
+
+        return summary;
+    }
+
+    /**
+     * @brief Read the solution printed in a .out file
+     * @param path File written by the solver
+     * @param cells Receives the cells of the solution
+     * @return False if the file has no solution
+     **/
+    static bool ReadExpected(const std::filesystem::path& path, uint8_t* cells)
+    {
+        std::ifstream stream(path);
+        std::string   line;
+        std::size_t   count = 0;
+        bool          found = false;
+
+        // The solved grid follows the success line, with separators between boxes
+        while (count < grid::BOARD_CELLS and std::getline(stream, line))
+        {
+            if (not found)
+            {
+                found = line.find("Solution found") != std::string::npos;
+                continue;
+            }
+
+            for (char c : line)
+            {
+                if (c >= '1' and c <= '9' and count < grid::BOARD_CELLS)
+                    cells[count++] = c - '0';
+            }
+        }
+
+        return count == grid::BOARD_CELLS;
+    }
+
+    bool LoadTier(const std::string& directory, std::vector<Puzzle>& puzzles)
+    {
+        std::error_code                    error;
+        std::vector<std::filesystem::path> files;
+
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+        {
+            if (entry.path().extension() == ".in")
+                files.push_back(entry.path());
+        }
+
+        if (error)
+            return false;
+
+        std::sort(files.begin(), files.end());
+
+        for (const std::filesystem::path& file : files)
+        {
+            std::ifstream stream(file);
+            std::string   text;
+
+            // Rows are split by spaces, as in the arguments of the solver
+            std::copy_if(std::istreambuf_iterator<char>(stream),
+                         std::istreambuf_iterator<char>(),
+                         std::back_inserter(text),
+                         [](char c) { return c != ' ' and c != '\n' and c != '\r'; });
+
+            grid::Board board;
+
+            if (text.size() != grid::BOARD_CELLS or
+                not kernel::Active().parse(text.data(), grid::CLASSIC, board))
+            {
+                std::fprintf(stderr, "Malformed puzzle: %s\n", file.c_str());
+                return false;
+            }
+
+            Puzzle puzzle;
+            puzzle.name = file.stem().string();
+            grid::ToGrid(board, puzzle.grid);
+
+            std::filesystem::path answer = file;
+            puzzle.hasExpected = ReadExpected(answer.replace_extension(".out"),
+                                              puzzle.expected);
+
+            puzzles.push_back(puzzle);
+        }
+
+        return true;
+    }
+
+    GroupResult RunGroup(const Config&              config,
+                         const std::string&         tier,
+                         Algorithm                  algorithm,
+                         const std::vector<Puzzle>& puzzles)
+    {
+        GroupResult group;
+        group.tier        = tier;
+        group.algorithm   = algorithm;
+        group.solved      = 0;
+        group.wrong       = 0;
+        group.runs        = 0;
+        group.counters    = perf::Sample { };
+        group.allocations = alloc::Counts { };
+        group.peakLive    = 0;
+        group.expanded    = 0;
+        group.shape.Clear();
+
+        std::vector<double> medians;
+        std::vector<double> times;
+        double              total = 0;
+
+        for (const Puzzle& puzzle : puzzles)
+        {
+            uint16_t start[GRID_SIZE][GRID_SIZE];
+            std::memcpy(start, puzzle.grid, sizeof(start));
+
+            CaseResult result = { puzzle.name, true, true, 0, 0, 0, 0 };
+
+            // A new solver per run, so every run starts from the same seed
+            for (std::size_t i = 0; i < config.warmup; i++)
+            {
+                sudoku::Solver(start, algorithm, config.options).Run();
+            }
+
+            times.clear();
+
+            for (std::size_t i = 0; i < config.repetitions; i++)
+            {
+                sudoku::Solver solver(start, algorithm, config.options);
+
+                sudoku::SolveResult run = solver.Run();
+
+                times.push_back(run.nanoseconds);
+                group.latency.Record(run.nanoseconds);
+                group.runs++;
+                group.expanded += run.expandedStates;
+
+                const alloc::Counts& allocations = run.allocations.total;
+
+                group.allocations.allocations += allocations.allocations;
+                group.allocations.frees += allocations.frees;
+                group.allocations.bytes += allocations.bytes;
+                group.peakLive = std::max(group.peakLive, run.allocations.peakLive);
+                group.shape.Merge(run.shape);
+
+                for (std::size_t event = 0; event < perf::EVENTS; event++)
+                {
+                    group.counters.values[event] += run.counters.values[event];
+                    group.counters.available[event] |= run.counters.available[event];
+                }
+                result.solved         = result.solved and run.solved;
+                result.expandedStates = run.expandedStates;
+                result.moves          = run.moves;
+
+                // The .out files are the oracle of every engine
+                if (run.solved and puzzle.hasExpected and
+                    std::memcmp(run.solution.cells,
+                                puzzle.expected,
+                                grid::BOARD_CELLS) != 0)
+                    result.correct = false;
+            }
+
+            Summary summary = Summarize(times);
+            result.medianNs = summary.median;
+            result.madNs    = summary.mad;
+
+            if (result.solved)
+                group.solved++;
+
+            if (not result.correct)
+                group.wrong++;
+
+            medians.push_back(result.medianNs);
+            total += result.medianNs;
+
+            group.cases.push_back(result);
+        }
+
+        group.summary          = Summarize(medians);
+        group.puzzlesPerSecond = total > 0 ? puzzles.size() * 1e9 / total : 0;
+
+        return group;
+    }
+
+    std::string FileName(Algorithm algorithm)
+    {
+        std::string name = sudoku::AlgorithmName(algorithm);
+
+        std::replace(name.begin(), name.end(), ' ', '-');
+
+        return name;
+    }
+
+    bool WriteDat(const std::string& directory, const std::vector<GroupResult>& groups)
+    {
+        for (const GroupResult& group : groups)
+        {
+            std::filesystem::path folder = directory;
+            std::error_code       error;
+
+            folder /= group.tier;
+
+            std::filesystem::create_directories(folder, error);
+
+            std::filesystem::path path =
+                folder / (FileName(group.algorithm) + "_" + group.tier + ".dat");
+
+            std::FILE* file = std::fopen(path.c_str(), "w");
+
+            if (file == nullptr)
+                return false;
+
+            for (const CaseResult& result : group.cases)
+            {
+                std::fprintf(file,
+                             "%s %.3f %zu\n",
+                             result.name.c_str(),
+                             result.medianNs / 1e6,
+                             result.expandedStates);
+            }
+
+            std::fclose(file);
+        }
+
+        return true;
+    }
+
+    bool WriteJson(const std::string&              path,
+                   const Config&                   config,
+                   const std::vector<GroupResult>& groups)
+    {
+        std::FILE* file = std::fopen(path.c_str(), "w");
+
+        if (file == nullptr)
+            return false;
+
+        const sudoku::SolverOptions& options = config.options;
+
+        std::fprintf(file, "{\n");
+        std::fprintf(file, "  \"kernel\": \"%s\",\n", kernel::Active().name);
+        std::fprintf(file, "  \"warmup\": %zu,\n", config.warmup);
+        std::fprintf(file, "  \"repetitions\": %zu,\n", config.repetitions);
+        std::fprintf(file, "  \"seed\": %" PRIu64 ",\n", options.seed);
+        std::fprintf(
+            file, "  \"propagate\": %s,\n", options.propagate ? "true" : "false");
+        std::fprintf(file, "  \"threads\": %zu,\n", options.threads);
+        std::fprintf(file,
+                     "  \"deterministic\": %s,\n",
+                     options.deterministic ? "true" : "false");
+        std::fprintf(file, "  \"iterations\": %zu,\n", options.iterations);
+        std::fprintf(file,
+                     "  \"perf_counters\": %s,\n",
+                     options.perfCounters ? "true" : "false");
+        std::fprintf(file, "  \"groups\": [");
+
+        for (std::size_t i = 0; i < groups.size(); i++)
+        {
+            const GroupResult& group = groups[i];
+
+            std::fprintf(file, "%s\n    {\n", i == 0 ? "" : ",");
+            std::fprintf(file, "      \"tier\": \"%s\",\n", group.tier.c_str());
+            std::fprintf(file,
+                         "      \"engine\": \"%c\",\n",
+                         static_cast<char>(group.algorithm));
+            std::fprintf(file,
+                         "      \"algorithm\": \"%s\",\n",
+                         sudoku::AlgorithmName(group.algorithm));
+            std::fprintf(file, "      \"cases\": %zu,\n", group.cases.size());
+            std::fprintf(file, "      \"solved\": %zu,\n", group.solved);
+            std::fprintf(file, "      \"wrong\": %zu,\n", group.wrong);
+            std::fprintf(file, "      \"median_ns\": %.0f,\n", group.summary.median);
+            std::fprintf(file, "      \"mad_ns\": %.0f,\n", group.summary.mad);
+            std::fprintf(file, "      \"p90_ns\": %.0f,\n", group.summary.p90);
+            std::fprintf(file, "      \"p99_ns\": %.0f,\n", group.summary.p99);
+            std::fprintf(file,
+                         "      \"puzzles_per_second\": %.3f,\n",
+                         group.puzzlesPerSecond);
+            std::fprintf(file, "      \"latency\": ");
+            latency::WriteJson(file, group.latency.Summary());
+            std::fprintf(file, ",\n");
+
+            // Totals over the runs, null for the events the kernel refused
+            if (options.perfCounters)
+            {
+                std::fprintf(file, "      \"runs\": %zu,\n", group.runs);
+                std::fprintf(file, "      \"counters\": {");
+
+                for (std::size_t event = 0; event < perf::EVENTS; event++)
+                {
+                    std::fprintf(file,
+                                 "%s \"%s\": ",
+                                 event == 0 ? "" : ",",
+                                 perf::EventName(static_cast<perf::Event>(event)));
+
+                    if (group.counters.available[event])
+                        std::fprintf(file, "%" PRIu64, group.counters.values[event]);
+                    else
+                        std::fprintf(file, "null");
+                }
+
+                std::fprintf(file, " },\n");
+            }
+
+            std::fprintf(file, "      \"results\": [");
+
+            for (std::size_t j = 0; j < group.cases.size(); j++)
+            {
+                const CaseResult& result = group.cases[j];
+
+                std::fprintf(file,
+                             "%s\n        { \"case\": \"%s\", \"solved\": %s, "
+                             "\"correct\": %s, \"median_ns\": %.0f, "
+                             "\"mad_ns\": %.0f, \"expanded_states\": %zu, "
+                             "\"moves\": %zu }",
+                             j == 0 ? "" : ",",
+                             result.name.c_str(),
+                             result.solved ? "true" : "false",
+                             result.correct ? "true" : "false",
+                             result.medianNs,
+                             result.madNs,
+                             result.expandedStates,
+                             result.moves);
+            }
+
+            std::fprintf(file, "\n      ]\n    }");
+        }
+
+        std::fprintf(file, "\n  ]\n}\n");
+
+        return std::fclose(file) == 0;
+    }
+} // namespace bench
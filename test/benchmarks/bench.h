@@ -0,0 +1,179 @@
+/*
+ * Filename: bench.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "alloc_tracker.h"
+#include "board.h"
+#include "constants.h"
+#include "latency.h"
+#include "perf_counters.h"
+#include "solver.h"
+#include "tree_shape.h"
+
+/**
+ * @brief Namespace containing the in-process benchmark of the solver
+ *
+ * Puzzles are loaded once and every engine runs in the same process, so the
+ * timings cover only the search, with nanosecond resolution
+ **/
+namespace bench
+{
+    // Difficulty tiers of test/inputs, easiest first
+    constexpr const char* TIERS[] = { "super_easy", "easy", "medium", "hard",
+                                      "super_hard" };
+
+    constexpr const char* ALGORITHMS = "BIAUGLP"; /**< Every engine */
+
+    /**
+     * @brief Puzzle of a tier
+     */
+    struct Puzzle
+    {
+        std::string name;                        /**< File name, without extension */
+        uint16_t    grid[GRID_SIZE][GRID_SIZE];  /**< Initial grid */
+        bool        hasExpected;                 /**< There is a .out file */
+        uint8_t     expected[grid::BOARD_CELLS]; /**< Solution of the .out file */
+    };
+
+    /**
+     * @brief Robust statistics of a set of samples
+     */
+    struct Summary
+    {
+        double median; /**< Middle sample */
+        double mad;    /**< Median absolute deviation from the median */
+        double p90;    /**< 90th percentile, nearest rank */
+        double p99;    /**< 99th percentile, nearest rank */
+    };
+
+    /**
+     * @brief Measurements of one puzzle
+     */
+    struct CaseResult
+    {
+        std::string name;           /**< Name of the puzzle */
+        bool        solved;         /**< Every repetition found a solution */
+        bool        correct;        /**< No solution differs from the .out file */
+        double      medianNs;       /**< Median time of the repetitions */
+        double      madNs;          /**< Spread of the repetitions */
+        std::size_t expandedStates; /**< Expanded states of the last repetition */
+        std::size_t moves;          /**< Moves of the local search in the last
+                                       repetition */
+    };
+
+    /**
+     * @brief Measurements of one engine over one tier
+     */
+    struct GroupResult
+    {
+        std::string             tier;             /**< Tier of the puzzles */
+        Algorithm               algorithm;        /**< Engine that solved them */
+        std::vector<CaseResult> cases;            /**< One entry per puzzle */
+        Summary                 summary;          /**< Of the puzzle medians */
+        double                  puzzlesPerSecond; /**< Puzzles over the total time */
+        std::size_t             solved;           /**< Puzzles solved */
+        std::size_t             wrong;            /**< Puzzles not correct */
+        std::size_t             runs;             /**< Measured runs */
+        perf::Sample            counters;         /**< Sum over the measured runs,
+                                                     with --perf-counters */
+        alloc::Counts           allocations;      /**< Sum over the measured runs,
+                                                     with SUDOKU_ALLOC_TRACKER */
+        uint64_t                peakLive;         /**< Highest peak of live bytes */
+        std::size_t             expanded;         /**< Sum of the expanded states of
+                                                     the measured runs */
+        shape::Histograms       shape;            /**< Sum over the measured runs,
+                                                     with --histograms */
+        latency::Histogram      latency;          /**< Time of every measured
+                                                     run, not only the medians */
+    };
+
+    /**
+     * @brief Settings of a benchmark run
+     */
+    struct Config
+    {
+        std::vector<std::string> tiers;       /**< Tiers to run */
+        std::string              algorithms;  /**< Letters of the engines to run */
+        std::string              inputDir;    /**< Folder with one folder per tier */
+        std::size_t              warmup;      /**< Unmeasured runs per puzzle */
+        std::size_t              repetitions; /**< Measured runs per puzzle */
+        std::size_t              cases;       /**< Puzzles per tier, at most */
+
+        sudoku::SolverOptions options; /**< Options of every solver. A fixed seed
+                                          makes the expanded states reproducible */
+    };
+
+    /**
+     * @brief Compute the median, MAD and tail percentiles of some samples
+     * @param samples Samples to summarize, in any order
+     * @return Statistics of the samples, all zero if there are none
+     **/
+    Summary Summarize(std::vector<double> samples);
+
+    /**
+     * @brief Load the puzzles of a tier, sorted by name
+     *
+     * The solution printed in the .out file of each puzzle, when there is one, is
+     * kept as the expected answer
+     *
+     * @param directory Folder of the tier, with the .in files
+     * @param puzzles Receives the puzzles
+     * @return False if the folder cannot be read or a puzzle is malformed
+     **/
+    bool LoadTier(const std::string& directory, std::vector<Puzzle>& puzzles);
+
+    /**
+     * @brief Run one engine over the puzzles of a tier
+     * @param config Settings of the run
+     * @param tier Name of the tier
+     * @param algorithm Engine to run
+     * @param puzzles Puzzles of the tier
+     * @return Measurements of the engine
+     **/
+    GroupResult RunGroup(const Config&              config,
+                         const std::string&         tier,
+                         Algorithm                  algorithm,
+                         const std::vector<Puzzle>& puzzles);
+
+    /**
+     * @brief Get the name of an engine as used in file names
+     * @param algorithm Engine to name
+     * @return Name printed by the solver, with spaces replaced by dashes
+     **/
+    std::string FileName(Algorithm algorithm);
+
+    /**
+     * @brief Write the results in the layout read by plot.py
+     *
+     * Each group goes to <directory>/<tier>/<ALGORITHM>_<tier>.dat, one line per
+     * puzzle: name, median time in milliseconds and expanded states
+     *
+     * @param directory Root of the data folders
+     * @param groups Results to write
+     * @return False if a file cannot be written
+     **/
+    bool WriteDat(const std::string& directory, const std::vector<GroupResult>& groups);
+
+    /**
+     * @brief Write the settings and results as JSON
+     * @param path File to write
+     * @param config Settings of the run
+     * @param groups Results to write
+     * @return False if the file cannot be written
+     **/
+    bool WriteJson(const std::string&              path,
+                   const Config&                   config,
+                   const std::vector<GroupResult>& groups);
+} // namespace bench
+
+#endif // BENCH_H_
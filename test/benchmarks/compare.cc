@@ -0,0 +1,596 @@
+/*
+ * Filename: compare.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "compare.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <utility>
+
+namespace bench
+{
+    /**
+     * @brief Value of a JSON document
+     */
+    struct JsonValue
+    {
+        enum class Type
+        {
+            NUL,
+            BOOLEAN,
+            NUMBER,
+            STRING,
+            ARRAY,
+            OBJECT
+        };
+
+        Type        type    = Type::NUL;
+        bool        boolean = false;
+        double      number  = 0;
+        std::string text;
+
+        std::vector<JsonValue>                         items;   /**< Of an array */
+        std::vector<std::pair<std::string, JsonValue>> members; /**< Of an object */
+
+        /**
+         * @brief Find a member of an object
+         * @param key Name of the member
+         * @return Member, or nullptr if there is none
+         **/
+        const JsonValue* Find(const char* key) const
+        {
+            for (const auto& member : this->members)
+            {
+                if (member.first == key)
+                    return &member.second;
+            }
+
+            return nullptr;
+        }
+    };
+
+    /**
+     * @brief Recursive descent parser of the JSON written by WriteJson
+     *
+     * Accepts any JSON document, but string escapes are only skipped, which is
+     * enough for the names of tiers, engines and cases
+     */
+    class JsonParser
+    {
+        private:
+            const std::string& m_text;
+            std::size_t        m_position;
+
+            void SkipBlanks()
+            {
+                while (this->m_position < this->m_text.size() and
+                       std::isspace(
+                           static_cast<unsigned char>(this->m_text[this->m_position])))
+                    this->m_position++;
+            }
+
+            bool Expect(char c)
+            {
+                this->SkipBlanks();
+
+                if (this->m_position >= this->m_text.size() or
+                    this->m_text[this->m_position] != c)
+                    return false;
+
+                this->m_position++;
+                return true;
+            }
+
+            bool ParseString(std::string& text)
+            {
+                if (not this->Expect('"'))
+                    return false;
+
+                text.clear();
+
+                while (this->m_position < this->m_text.size())
+                {
+                    char c = this->m_text[this->m_position++];
+
+                    if (c == '"')
+                        return true;
+
+                    if (c == '\\' and this->m_position < this->m_text.size())
+                        c = this->m_text[this->m_position++];
+
+                    text.push_back(c);
+                }
+
+                return false;
+            }
+
+            bool ParseLiteral(const char* literal)
+            {
+                std::size_t length = std::char_traits<char>::length(literal);
+
+                if (this->m_text.compare(this->m_position, length, literal) != 0)
+                    return false;
+
+                this->m_position += length;
+                return true;
+            }
+
+        public:
+            JsonParser(const std::string& text)
+                : m_text(text),
+                  m_position(0)
+            { }
+
+            /**
+             * @brief Parse the next value
+             * @param value Receives the value
+             * @return False on a syntax error
+             **/
+            bool Parse(JsonValue& value)
+            {
+                this->SkipBlanks();
+
+                if (this->m_position >= this->m_text.size())
+                    return false;
+
+                char c = this->m_text[this->m_position];
+
+                if (c == '{')
+                {
+                    value.type = JsonValue::Type::OBJECT;
+                    this->m_position++;
+
+                    if (this->Expect('}'))
+                        return true;
+
+                    do
+                    {
+                        std::pair<std::string, JsonValue> member;
+
+                        if (not this->ParseString(member.first) or
+                            not this->Expect(':') or not this->Parse(member.second))
+                            return false;
+
+                        value.members.push_back(std::move(member));
+                    } while (this->Expect(','));
+
+                    return this->Expect('}');
+                }
+
+                if (c == '[')
+                {
+                    value.type = JsonValue::Type::ARRAY;
+                    this->m_position++;
+
+                    if (this->Expect(']'))
+                        return true;
+
+                    do
+                    {
+                        value.items.emplace_back();
+
+                        if (not this->Parse(value.items.back()))
+                            return false;
+                    } while (this->Expect(','));
+
+                    return this->Expect(']');
+                }
+
+                if (c == '"')
+                {
+                    value.type = JsonValue::Type::STRING;
+                    return this->ParseString(value.text);
+                }
+
+                if (this->ParseLiteral("true") or this->ParseLiteral("false"))
+                {
+                    value.type    = JsonValue::Type::BOOLEAN;
+                    value.boolean = c == 't';
+                    return true;
+                }
+
+                if (this->ParseLiteral("null"))
+                {
+                    value.type = JsonValue::Type::NUL;
+                    return true;
+                }
+
+                const char* start = this->m_text.c_str() + this->m_position;
+                char*       end;
+
+                value.type   = JsonValue::Type::NUMBER;
+                value.number = std::strtod(start, &end);
+
+                this->m_position += end - start;
+
+                return end != start;
+            }
+
+            /**
+             * @brief Check that nothing but blanks follows the parsed value
+             * @return True if the whole text was parsed
+             **/
+            bool AtEnd()
+            {
+                this->SkipBlanks();
+                return this->m_position == this->m_text.size();
+            }
+    };
+
+    /**
+     * @brief Get a number member of an object
+     * @param object Object to read
+     * @param key Name of the member
+     * @param fallback Value returned when the member is missing
+     * @return Value of the member
+     **/
+    static double Number(const JsonValue& object, const char* key, double fallback)
+    {
+        const JsonValue* value = object.Find(key);
+
+        return value != nullptr and value->type == JsonValue::Type::NUMBER
+                   ? value->number
+                   : fallback;
+    }
+
+    /**
+     * @brief Get a boolean member of an object
+     * @param object Object to read
+     * @param key Name of the member
+     * @param fallback Value returned when the member is missing
+     * @return Value of the member
+     **/
+    static bool Boolean(const JsonValue& object, const char* key, bool fallback)
+    {
+        const JsonValue* value = object.Find(key);
+
+        return value != nullptr and value->type == JsonValue::Type::BOOLEAN
+                   ? value->boolean
+                   : fallback;
+    }
+
+    /**
+     * @brief Get a string member of an object
+     * @param object Object to read
+     * @param key Name of the member
+     * @return Value of the member, empty when missing
+     **/
+    static std::string Text(const JsonValue& object, const char* key)
+    {
+        const JsonValue* value = object.Find(key);
+
+        return value != nullptr and value->type == JsonValue::Type::STRING ? value->text
+                                                                            : "";
+    }
+
+    bool ReadResults(const std::string&        path,
+                     Config&                   config,
+                     std::vector<GroupResult>& groups)
+    {
+        std::ifstream stream(path);
+
+        if (not stream)
+            return false;
+
+        std::string text((std::istreambuf_iterator<char>(stream)),
+                         std::istreambuf_iterator<char>());
+
+        JsonValue  root;
+        JsonParser parser(text);
+
+        if (not parser.Parse(root) or not parser.AtEnd() or
+            root.type != JsonValue::Type::OBJECT)
+            return false;
+
+        const JsonValue* list = root.Find("groups");
+
+        if (list == nullptr or list->type != JsonValue::Type::ARRAY)
+            return false;
+
+        sudoku::SolverOptions& options = config.options;
+
+        config.warmup         = Number(root, "warmup", config.warmup);
+        config.repetitions    = Number(root, "repetitions", config.repetitions);
+        options.seed          = Number(root, "seed", options.seed);
+        options.threads       = Number(root, "threads", options.threads);
+        options.iterations    = Number(root, "iterations", options.iterations);
+        options.propagate     = Boolean(root, "propagate", false);
+        options.deterministic = Boolean(root, "deterministic", false);
+
+        groups.clear();
+
+        for (const JsonValue& item : list->items)
+        {
+            std::string engine = Text(item, "engine");
+            const auto* cases  = item.Find("results");
+
+            if (engine.size() != 1 or cases == nullptr or
+                cases->type != JsonValue::Type::ARRAY)
+                return false;
+
+            GroupResult group;
+            group.tier             = Text(item, "tier");
+            group.algorithm        = static_cast<Algorithm>(engine[0]);
+            group.summary.median   = Number(item, "median_ns", 0);
+            group.summary.mad      = Number(item, "mad_ns", 0);
+            group.summary.p90      = Number(item, "p90_ns", 0);
+            group.summary.p99      = Number(item, "p99_ns", 0);
+            group.puzzlesPerSecond = Number(item, "puzzles_per_second", 0);
+            group.solved           = Number(item, "solved", 0);
+            group.wrong            = Number(item, "wrong", 0);
+
+            for (const JsonValue& entry : cases->items)
+            {
+                CaseResult result;
+                result.name           = Text(entry, "case");
+                result.solved         = Boolean(entry, "solved", false);
+                result.correct        = Boolean(entry, "correct", true);
+                result.medianNs       = Number(entry, "median_ns", 0);
+                result.madNs          = Number(entry, "mad_ns", 0);
+                result.expandedStates = Number(entry, "expanded_states", 0);
+                result.moves          = Number(entry, "moves", 0);
+
+                group.cases.push_back(result);
+            }
+
+            groups.push_back(group);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief One-sided p-values of the Wilcoxon signed-rank test
+     *
+     * Uses the normal approximation with continuity and tie corrections
+     *
+     * @param differences Paired differences, zeros are dropped
+     * @param pAbove Receives the p-value of the differences being positive
+     * @param pBelow Receives the p-value of the differences being negative
+     **/
+    static void
+    SignedRank(std::vector<double> differences, double& pAbove, double& pBelow)
+    {
+        differences.erase(std::remove(differences.begin(), differences.end(), 0.0),
+                          differences.end());
+
+        pAbove = pBelow = 1;
+
+        double n = differences.size();
+
+        if (n == 0)
+            return;
+
+        std::sort(differences.begin(),
+                  differences.end(),
+                  [](double a, double b) { return std::fabs(a) < std::fabs(b); });
+
+        double positive = 0; // Sum of the ranks of the positive differences
+        double ties     = 0; // Sum of t^3 - t over groups of tied magnitudes
+
+        for (std::size_t i = 0; i < differences.size();)
+        {
+            std::size_t j = i;
+
+            while (j < differences.size() and
+                   std::fabs(differences[j]) == std::fabs(differences[i]))
+                j++;
+
+            // Tied magnitudes share the average of their ranks
+            double rank = (i + 1 + j) / 2.0;
+            double t    = j - i;
+
+            for (std::size_t k = i; k < j; k++)
+            {
+                if (differences[k] > 0)
+                    positive += rank;
+            }
+
+            ties += t * t * t - t;
+            i = j;
+        }
+
+        double mean     = n * (n + 1) / 4;
+        double variance = n * (n + 1) * (2 * n + 1) / 24 - ties / 48;
+
+        if (variance <= 0)
+            return;
+
+        double deviation = std::sqrt(variance);
+
+        pAbove = 0.5 * std::erfc((positive - mean - 0.5) / deviation / std::sqrt(2.0));
+        pBelow = 0.5 * std::erfc((mean - positive - 0.5) / deviation / std::sqrt(2.0));
+    }
+
+    /**
+     * @brief Compare the cases of a group found in both runs
+     * @param base Group of the baseline
+     * @param current Same group in the run
+     * @param tolerance Relative change in time that is accepted
+     * @param timing If false, times are not compared
+     * @param comparison Receives the differences
+     **/
+    static void CompareGroup(const GroupResult& base,
+                             const GroupResult& current,
+                             double             tolerance,
+                             bool               timing,
+                             Comparison&        comparison)
+    {
+        std::map<std::string, const CaseResult*> cases;
+
+        for (const CaseResult& result : current.cases)
+        {
+            cases[result.name] = &result;
+        }
+
+        std::vector<double> logRatios;
+        std::size_t         slowerCases = 0;
+        std::size_t         fasterCases = 0;
+
+        for (const CaseResult& old : base.cases)
+        {
+            auto found = cases.find(old.name);
+
+            if (found == cases.end())
+            {
+                comparison.details.push_back(old.name + ": did not run");
+                comparison.verdict = Verdict::MISSING;
+                continue;
+            }
+
+            const CaseResult& now = *found->second;
+
+            comparison.cases++;
+
+            if (not now.correct)
+            {
+                comparison.wrong++;
+                comparison.details.push_back(old.name + ": solution differs from .out");
+            }
+
+            if (old.solved and not now.solved)
+            {
+                comparison.lost++;
+                comparison.details.push_back(old.name + ": not solved anymore");
+            }
+
+            if (old.expandedStates != now.expandedStates or old.moves != now.moves)
+            {
+                std::ostringstream line;
+                line << old.name << ": ";
+
+                if (old.expandedStates != now.expandedStates)
+                    line << "expanded states " << old.expandedStates << " -> "
+                         << now.expandedStates;
+                else
+                    line << "moves " << old.moves << " -> " << now.moves;
+
+                comparison.changed++;
+                comparison.details.push_back(line.str());
+            }
+
+            // The clock has a resolution of a few nanoseconds, so zeros are noise
+            double before = std::max(old.medianNs, 1.0);
+            double after  = std::max(now.medianNs, 1.0);
+
+            logRatios.push_back(std::log(after / before));
+
+            // Scaled MADs estimate the standard deviation of normal noise
+            double noise = NOISE_MADS * 1.4826 * (old.madNs + now.madNs);
+
+            if (after > before * (1 + tolerance) and after - before > noise)
+                slowerCases++;
+            else if (after * (1 + tolerance) < before and before - after > noise)
+                fasterCases++;
+        }
+
+        if (not logRatios.empty())
+        {
+            std::vector<double> sorted = logRatios;
+            std::sort(sorted.begin(), sorted.end());
+
+            std::size_t middle = sorted.size() / 2;
+            double      median = sorted.size() % 2 == 1
+                                     ? sorted[middle]
+                                     : (sorted[middle - 1] + sorted[middle]) / 2;
+
+            comparison.ratio = std::exp(median);
+        }
+
+        bool slower = false;
+        bool faster = false;
+
+        if (timing and logRatios.size() >= MIN_PAIRED)
+        {
+            double pAbove, pBelow;
+            SignedRank(logRatios, pAbove, pBelow);
+
+            comparison.pValue = comparison.ratio >= 1 ? pAbove : pBelow;
+
+            slower = pAbove < SIGNIFICANCE and comparison.ratio > 1 + tolerance;
+            faster = pBelow < SIGNIFICANCE and comparison.ratio * (1 + tolerance) < 1;
+        }
+        else if (timing and not logRatios.empty())
+        {
+            // Too few cases for the rank test, so each one must clear its noise
+            slower = slowerCases == logRatios.size();
+            faster = fasterCases == logRatios.size();
+        }
+
+        // The worst outcome wins
+        if (comparison.verdict == Verdict::MISSING)
+            return;
+
+        if (comparison.wrong > 0)
+            comparison.verdict = Verdict::WRONG;
+        else if (comparison.changed > 0 or comparison.lost > 0)
+            comparison.verdict = Verdict::CHANGED;
+        else if (slower)
+            comparison.verdict = Verdict::SLOWER;
+        else if (faster)
+            comparison.verdict = Verdict::FASTER;
+    }
+
+    std::vector<Comparison> Compare(const std::vector<GroupResult>& baseline,
+                                    const std::vector<GroupResult>& current,
+                                    double                          tolerance,
+                                    bool                            timing)
+    {
+        std::vector<Comparison> comparisons;
+
+        for (const GroupResult& base : baseline)
+        {
+            Comparison comparison = { base.tier, base.algorithm, 0, 0, 0, 0, 1.0,
+                                      NAN,       Verdict::OK,    { } };
+
+            auto same = [&base](const GroupResult& group)
+            { return group.tier == base.tier and group.algorithm == base.algorithm; };
+
+            auto found = std::find_if(current.begin(), current.end(), same);
+
+            if (found == current.end())
+                comparison.verdict = Verdict::MISSING;
+            else
+                CompareGroup(base, *found, tolerance, timing, comparison);
+
+            comparisons.push_back(comparison);
+        }
+
+        return comparisons;
+    }
+
+    const char* VerdictName(Verdict verdict)
+    {
+        switch (verdict)
+        {
+            case Verdict::OK:
+                return "ok";
+            case Verdict::FASTER:
+                return "faster";
+            case Verdict::SLOWER:
+                return "SLOWER";
+            case Verdict::CHANGED:
+                return "CHANGED";
+            case Verdict::WRONG:
+                return "WRONG";
+            case Verdict::MISSING:
+                return "MISSING";
+            default:
+                return "unknown";
+        }
+    }
+
+    bool IsFailure(Verdict verdict)
+    {
+        return verdict != Verdict::OK and verdict != Verdict::FASTER;
+    }
+} // namespace bench
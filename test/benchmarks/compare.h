@@ -0,0 +1,101 @@
+/*
+ * Filename: compare.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef COMPARE_H_
+#define COMPARE_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+
+namespace bench
+{
+    constexpr double      SIGNIFICANCE = 0.01; /**< One-sided p-value of a change */
+    constexpr std::size_t MIN_PAIRED   = 6;    /**< Cases needed by the rank test */
+    constexpr double      NOISE_MADS   = 3;    /**< Spread that small groups must
+                                                  exceed, in scaled MADs */
+
+    /**
+     * @brief Outcome of the comparison of a group with the baseline
+     */
+    enum class Verdict
+    {
+        OK,      /**< No significant change */
+        FASTER,  /**< Significantly faster, beyond the tolerance */
+        SLOWER,  /**< Significantly slower, beyond the tolerance */
+        CHANGED, /**< Expanded states differ, or a solved puzzle is not anymore */
+        WRONG,   /**< A solution differs from the .out file */
+        MISSING  /**< The group or some of its cases did not run */
+    };
+
+    /**
+     * @brief Differences of one engine over one tier
+     */
+    struct Comparison
+    {
+        std::string tier;      /**< Tier of the puzzles */
+        Algorithm   algorithm; /**< Engine compared */
+        std::size_t cases;     /**< Cases found in both runs */
+        std::size_t changed;   /**< Cases whose expanded states or moves differ */
+        std::size_t lost;      /**< Cases solved only by the baseline */
+        std::size_t wrong;     /**< Cases with a solution other than the .out file */
+        double      ratio;     /**< Median ratio of the times, current over baseline */
+        double      pValue;    /**< Of the change in time, or NaN without the test */
+        Verdict     verdict;   /**< Worst outcome of the group */
+
+        std::vector<std::string> details; /**< One line per case that changed */
+    };
+
+    /**
+     * @brief Read the settings and results written by WriteJson
+     * @param path File to read
+     * @param config Receives the settings of the search and of the repetitions
+     * @param groups Receives the results
+     * @return False if the file cannot be read or is not a benchmark report
+     **/
+    bool ReadResults(const std::string&        path,
+                     Config&                   config,
+                     std::vector<GroupResult>& groups);
+
+    /**
+     * @brief Compare a run with a baseline
+     *
+     * Expanded states must match exactly, since both runs use the same seed.
+     * Times are compared through the ratio of the medians of each case: groups
+     * with at least MIN_PAIRED cases use a one-sided Wilcoxon signed-rank test on
+     * the log ratios, smaller ones require every case to move by more than
+     * NOISE_MADS times its spread. A change in time only counts when it is
+     * significant and the median ratio is beyond the tolerance
+     *
+     * @param baseline Results of the baseline
+     * @param current Results of the run
+     * @param tolerance Relative change in time that is accepted, like 0.1
+     * @param timing If false, only counts and solutions are compared
+     * @return One comparison per group of the baseline
+     **/
+    std::vector<Comparison> Compare(const std::vector<GroupResult>& baseline,
+                                    const std::vector<GroupResult>& current,
+                                    double                          tolerance,
+                                    bool                            timing);
+
+    /**
+     * @brief Get the name of a verdict, as printed in the report
+     * @param verdict Verdict to name
+     * @return Name of the verdict
+     **/
+    const char* VerdictName(Verdict verdict);
+
+    /**
+     * @brief Check if a verdict fails the comparison
+     * @param verdict Verdict to check
+     * @return True for every verdict other than OK and FASTER
+     **/
+    bool IsFailure(Verdict verdict);
+} // namespace bench
+
+#endif // COMPARE_H_
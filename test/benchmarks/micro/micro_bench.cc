@@ -0,0 +1,646 @@
+/*
+ * Filename: micro_bench.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ *
+ * Microbenchmarks of the grid primitives and of the containers used as frontiers,
+ * each one against the std and arena-based alternatives
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include "board.h"
+#include "grid_utils.h"
+#include "queue_slkd.h"
+#include "search_node.h"
+#include "stack_slkd.h"
+#include "vector.h"
+
+constexpr uint64_t    SAMPLE_NS = 2000000; /**< Least duration of a sample */
+constexpr std::size_t SIZES[]   = { 64, 4096, 262144 }; /**< Frontier sizes */
+
+/** Puzzle used by the primitives, with 21 clues */
+constexpr const char* PUZZLE =
+    "800000000003600000070090200050007000000045700000100030001000068008500010090000400";
+
+/**
+ * @brief Settings of the microbenchmarks
+ */
+struct Config
+{
+    std::size_t samples; /**< Measured samples per benchmark */
+    std::string filter;  /**< Only benchmarks whose name contains it */
+};
+
+/**
+ * @brief Keep the compiler from discarding a value computed by a benchmark
+ * @param value Value to keep
+ **/
+template<typename T>
+inline void Keep(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Measure a benchmark and print its line
+ *
+ * The number of calls per sample doubles until a sample lasts SAMPLE_NS, so short
+ * operations are not drowned by the resolution of the clock. The median and the
+ * MAD of the samples are printed per operation
+ *
+ * @param config Settings of the microbenchmarks
+ * @param name Name of the benchmark
+ * @param size Frontier size, 0 for the primitives
+ * @param operations Operations done by each call of body
+ * @param body Code to measure
+ **/
+void Measure(const Config&                config,
+             const std::string&           name,
+             std::size_t                  size,
+             std::size_t                  operations,
+             const std::function<void()>& body)
+{
+    using Clock = std::chrono::steady_clock;
+
+    if (name.find(config.filter) == std::string::npos)
+        return;
+
+    auto sample = [&body](std::size_t calls)
+    {
+        auto start = Clock::now();
+
+        for (std::size_t i = 0; i < calls; i++)
+        {
+            body();
+        }
+
+        return static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                                 start)
+                .count());
+    };
+
+    std::size_t calls = 1;
+
+    // Also warms up the caches and the branch predictors
+    while (sample(calls) < SAMPLE_NS)
+    {
+        calls *= 2;
+    }
+
+    std::vector<double> times(config.samples);
+
+    for (double& time : times)
+    {
+        time = sample(calls) / (calls * operations);
+    }
+
+    std::sort(times.begin(), times.end());
+    double median = times[times.size() / 2];
+
+    for (double& time : times)
+    {
+        time = std::fabs(time - median);
+    }
+
+    std::sort(times.begin(), times.end());
+    double mad = times[times.size() / 2];
+
+    // The primitives have no size
+    std::string column = size > 0 ? std::to_string(size) : "-";
+
+    std::printf("%-34s %8s %12.2f %7.1f%%\n",
+                name.c_str(),
+                column.c_str(),
+                median,
+                median > 0 ? 100 * mad / median : 0);
+}
+
+/**
+ * @brief Time the primitives of grid_utils over the grid and the board
+ * @param config Settings of the microbenchmarks
+ **/
+void Primitives(const Config& config)
+{
+    uint16_t    grid[GRID_SIZE][GRID_SIZE];
+    uint16_t    copy[GRID_SIZE][GRID_SIZE];
+    grid::Board board;
+    grid::Board boardCopy;
+
+    for (std::size_t cell = 0; cell < grid::BOARD_CELLS; cell++)
+    {
+        grid[cell / GRID_SIZE][cell % GRID_SIZE] = PUZZLE[cell] - '0';
+    }
+
+    grid::FromGrid(grid, board);
+
+    // Every position and number, as the expansion of a node does
+    Measure(config,
+            "IsValid grid",
+            0,
+            grid::BOARD_CELLS * GRID_SIZE,
+            [&grid]()
+            {
+                for (uint16_t cell = 0; cell < grid::BOARD_CELLS; cell++)
+                {
+                    for (uint16_t num = 1; num <= GRID_SIZE; num++)
+                    {
+                        Keep(grid::IsValid(
+                            grid, cell / GRID_SIZE, cell % GRID_SIZE, num));
+                    }
+                }
+            });
+    Measure(config,
+            "IsValid board",
+            0,
+            grid::BOARD_CELLS * GRID_SIZE,
+            [&board]()
+            {
+                for (uint16_t cell = 0; cell < grid::BOARD_CELLS; cell++)
+                {
+                    for (uint16_t num = 1; num <= GRID_SIZE; num++)
+                    {
+                        Keep(grid::IsValid(
+                            board, cell / GRID_SIZE, cell % GRID_SIZE, num));
+                    }
+                }
+            });
+
+    uint16_t row;
+    uint16_t col;
+
+    Measure(config,
+            "FindEmptyCell grid",
+            0,
+            1,
+            [&]()
+            {
+                Keep(grid::FindEmptyCell(grid, row, col));
+                Keep(row);
+            });
+    Measure(config,
+            "FindEmptyCell board",
+            0,
+            1,
+            [&]()
+            {
+                Keep(grid::FindEmptyCell(board, row, col));
+                Keep(row);
+            });
+
+    // The changes of a node at depth 20, applied over the empty cells of the
+    // puzzle, as BFS does when it rebuilds a state
+    Vector<State> changes;
+
+    for (uint16_t cell = 0; cell < grid::BOARD_CELLS and changes.Size() < 20; cell++)
+    {
+        if (PUZZLE[cell] == '0')
+        {
+            changes.PushBack(State(Pair<uint16_t, uint16_t>(cell / GRID_SIZE,
+                                                            cell % GRID_SIZE),
+                                   1 + cell % GRID_SIZE));
+        }
+    }
+
+    Measure(config,
+            "ApplyChanges grid",
+            0,
+            changes.Size(),
+            [&]()
+            {
+                grid::CopyGrid(grid, copy);
+                grid::ApplyChanges(copy, changes);
+                Keep(copy);
+            });
+    Measure(config,
+            "ApplyChanges board",
+            0,
+            changes.Size(),
+            [&]()
+            {
+                grid::CopyGrid(board, boardCopy);
+                grid::ApplyChanges(boardCopy, changes);
+                Keep(boardCopy);
+            });
+
+    Measure(config,
+            "CopyGrid grid",
+            0,
+            1,
+            [&]()
+            {
+                grid::CopyGrid(grid, copy);
+                Keep(copy);
+            });
+    Measure(config,
+            "CopyGrid board",
+            0,
+            1,
+            [&]()
+            {
+                grid::CopyGrid(board, boardCopy);
+                Keep(boardCopy);
+            });
+}
+
+/**
+ * @brief Queue over a power-of-two ring buffer, an arena that only grows
+ */
+class RingQueue
+{
+    private:
+        std::vector<uint32_t> m_items; /**< Slots, a power of two */
+        std::size_t           m_head;  /**< Position of the first item */
+        std::size_t           m_size;  /**< Number of items */
+
+    public:
+        RingQueue()
+            : m_items(64),
+              m_head(0),
+              m_size(0)
+        { }
+
+        void Enqueue(uint32_t item)
+        {
+            if (this->m_size == this->m_items.size())
+            {
+                std::rotate(this->m_items.begin(),
+                            this->m_items.begin() + this->m_head,
+                            this->m_items.end());
+                this->m_items.resize(2 * this->m_items.size());
+                this->m_head = 0;
+            }
+
+            this->m_items[(this->m_head + this->m_size++) &
+                          (this->m_items.size() - 1)] = item;
+        }
+
+        uint32_t Dequeue()
+        {
+            uint32_t item = this->m_items[this->m_head];
+            this->m_head  = (this->m_head + 1) & (this->m_items.size() - 1);
+            this->m_size--;
+
+            return item;
+        }
+
+        bool IsEmpty() const
+        {
+            return this->m_size == 0;
+        }
+};
+
+/**
+ * @brief Min-priority queue with one bucket per priority, for the 16-bit f of the
+ * search nodes, whose range is small
+ */
+class BucketQueue
+{
+    private:
+        std::vector<std::vector<uint32_t>> m_buckets; /**< Items of each priority */
+        std::size_t                        m_lowest;  /**< Lowest priority used */
+        std::size_t                        m_size;    /**< Number of items */
+
+    public:
+        BucketQueue()
+            : m_lowest(SIZE_MAX),
+              m_size(0)
+        { }
+
+        void Push(uint16_t priority, uint32_t item)
+        {
+            if (priority >= this->m_buckets.size())
+                this->m_buckets.resize(priority + 1);
+
+            this->m_buckets[priority].push_back(item);
+            this->m_lowest = std::min<std::size_t>(this->m_lowest, priority);
+            this->m_size++;
+        }
+
+        uint32_t Pop()
+        {
+            while (this->m_buckets[this->m_lowest].empty())
+            {
+                this->m_lowest++;
+            }
+
+            uint32_t item = this->m_buckets[this->m_lowest].back();
+            this->m_buckets[this->m_lowest].pop_back();
+
+            if (--this->m_size == 0)
+                this->m_lowest = SIZE_MAX;
+
+            return item;
+        }
+};
+
+/**
+ * @brief Time a push of size items followed by as many pops
+ * @param config Settings of the microbenchmarks
+ * @param name Name of the benchmark
+ * @param size Number of items
+ * @param push Push of one item
+ * @param pop Pop of one item
+ **/
+template<typename Push, typename Pop>
+void MeasureFrontier(const Config&      config,
+                     const std::string& name,
+                     std::size_t        size,
+                     Push               push,
+                     Pop                pop)
+{
+    Measure(config,
+            name,
+            size,
+            2 * size,
+            [&]()
+            {
+                for (std::size_t i = 0; i < size; i++)
+                {
+                    push(static_cast<uint32_t>(i));
+                }
+
+                for (std::size_t i = 0; i < size; i++)
+                {
+                    Keep(pop());
+                }
+            });
+}
+
+/**
+ * @brief Time the frontiers of the engines against their alternatives
+ * @param config Settings of the microbenchmarks
+ **/
+void Frontiers(const Config& config)
+{
+    using MinHeap =
+        std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>>;
+
+    for (std::size_t size : SIZES)
+    {
+        // FIFO of BFS. The containers live across calls, as in a search, so
+        // only the first call pays for the growth
+        slkd::Queue<uint32_t> queue;
+        std::queue<uint32_t>  stdQueue;
+        RingQueue             ring;
+
+        MeasureFrontier(
+            config,
+            "fifo slkd::Queue",
+            size,
+            [&queue](uint32_t item) { queue.Enqueue(item); },
+            [&queue]() { return queue.Dequeue(); });
+        MeasureFrontier(
+            config,
+            "fifo std::queue",
+            size,
+            [&stdQueue](uint32_t item) { stdQueue.push(item); },
+            [&stdQueue]()
+            {
+                uint32_t item = stdQueue.front();
+                stdQueue.pop();
+                return item;
+            });
+        MeasureFrontier(
+            config,
+            "fifo ring arena",
+            size,
+            [&ring](uint32_t item) { ring.Enqueue(item); },
+            [&ring]() { return ring.Dequeue(); });
+
+        // LIFO of IDDFS
+        slkd::Stack<uint32_t> stack;
+        std::stack<uint32_t>  stdStack;
+        std::vector<uint32_t> array;
+
+        MeasureFrontier(
+            config,
+            "lifo slkd::Stack",
+            size,
+            [&stack](uint32_t item) { stack.Push(item); },
+            [&stack]() { return stack.Pop(); });
+        MeasureFrontier(
+            config,
+            "lifo std::stack",
+            size,
+            [&stdStack](uint32_t item) { stdStack.push(item); },
+            [&stdStack]()
+            {
+                uint32_t item = stdStack.top();
+                stdStack.pop();
+                return item;
+            });
+        MeasureFrontier(
+            config,
+            "lifo std::vector",
+            size,
+            [&array](uint32_t item) { array.push_back(item); },
+            [&array]()
+            {
+                uint32_t item = array.back();
+                array.pop_back();
+                return item;
+            });
+
+        // Priority frontier of UCS, A* and GBFS: keys pack the priority over the
+        // node index. Priorities follow the spread of f in the engines
+        MinHeap     heap;
+        BucketQueue buckets;
+
+        MeasureFrontier(
+            config,
+            "priority std::priority_queue",
+            size,
+            [&heap](uint32_t item)
+            { heap.push(static_cast<uint64_t>(item * 7919 % 128) << 32 | item); },
+            [&heap]()
+            {
+                uint64_t key = heap.top();
+                heap.pop();
+                return static_cast<uint32_t>(key);
+            });
+        MeasureFrontier(
+            config,
+            "priority bucket arena",
+            size,
+            [&buckets](uint32_t item) { buckets.Push(item * 7919 % 128, item); },
+            [&buckets]() { return buckets.Pop(); });
+
+        // Append-only list, as the changes of a node and the nodes of the store.
+        // Vector has no pop, so the second half reads the items back
+        Measure(config,
+                "append Vector",
+                size,
+                2 * size,
+                [size]()
+                {
+                    Vector<uint32_t> items;
+
+                    for (std::size_t i = 0; i < size; i++)
+                    {
+                        items.PushBack(i);
+                    }
+
+                    for (std::size_t i = 0; i < size; i++)
+                    {
+                        Keep(items[i]);
+                    }
+                });
+        Measure(config,
+                "append std::vector",
+                size,
+                2 * size,
+                [size]()
+                {
+                    std::vector<uint32_t> items;
+
+                    for (std::size_t i = 0; i < size; i++)
+                    {
+                        items.push_back(i);
+                    }
+
+                    for (std::size_t i = 0; i < size; i++)
+                    {
+                        Keep(items[i]);
+                    }
+                });
+        Measure(config,
+                "append std::vector reserved",
+                size,
+                2 * size,
+                [size]()
+                {
+                    std::vector<uint32_t> items;
+                    items.reserve(size);
+
+                    for (std::size_t i = 0; i < size; i++)
+                    {
+                        items.push_back(i);
+                    }
+
+                    for (std::size_t i = 0; i < size; i++)
+                    {
+                        Keep(items[i]);
+                    }
+                });
+    }
+}
+
+/**
+ * @brief Time the storage of the boards of the nodes: the NodeStore arena, which
+ * recycles payloads, against one heap allocation per board
+ * @param config Settings of the microbenchmarks
+ **/
+void Payloads(const Config& config)
+{
+    grid::Board board;
+    board.Clear();
+
+    for (std::size_t size : SIZES)
+    {
+        sudoku::NodeStore store;
+
+        Measure(config,
+                "payload NodeStore",
+                size,
+                2 * size,
+                [&]()
+                {
+                    store.Clear();
+                    uint32_t root = store.AddRoot(board);
+
+                    for (std::size_t i = 0; i < size; i++)
+                    {
+                        Keep(store.AddChild(root,
+                                            i % GRID_SIZE,
+                                            i / GRID_SIZE % GRID_SIZE,
+                                            1,
+                                            grid::CLASSIC));
+                    }
+
+                    for (uint32_t id = 1; id <= size; id++)
+                    {
+                        store.Release(id);
+                    }
+                });
+
+        std::vector<std::unique_ptr<grid::Board>> boards;
+
+        Measure(config,
+                "payload new Board",
+                size,
+                2 * size,
+                [&]()
+                {
+                    for (std::size_t i = 0; i < size; i++)
+                    {
+                        boards.push_back(std::make_unique<grid::Board>(board));
+                        boards.back()->Set(
+                            i % GRID_SIZE, i / GRID_SIZE % GRID_SIZE, 1);
+                    }
+
+                    boards.clear();
+                });
+    }
+}
+
+void HelpMessage(const char* program)
+{
+    std::fprintf(stderr, "Usage: %s [options]\n", program);
+    std::fprintf(stderr, "Options:\n");
+    std::fprintf(stderr, "\t--samples=<n>  measured samples per benchmark (15)\n");
+    std::fprintf(stderr, "\t--filter=<s>   only benchmarks whose name contains s\n");
+}
+
+int main(int argc, char* argv[])
+{
+    Config config = { 15, "" };
+
+    for (int i = 1; i < argc; i++)
+    {
+        char* end;
+
+        if (std::strncmp(argv[i], "--samples=", 10) == 0)
+        {
+            config.samples = std::strtoull(argv[i] + 10, &end, 10);
+
+            if (*end != '\0' or config.samples == 0)
+            {
+                HelpMessage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        }
+        else if (std::strncmp(argv[i], "--filter=", 9) == 0)
+        {
+            config.filter = argv[i] + 9;
+        }
+        else
+        {
+            HelpMessage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::printf("%-34s %8s %12s %8s\n", "benchmark", "size", "ns/op", "mad");
+
+    Primitives(config);
+    Frontiers(config);
+    Payloads(config);
+
+    return EXIT_SUCCESS;
+}
@@ -9,8 +9,8 @@
 # Usage: python3 plot.py
 #
 # NOTE: This script assumes that the benchmarking data is in the data/ directory
-#       and that the data was generated by the benchmark.sh script. Run the
-#       benchmark.sh script before running this script.
+#       and that the data was generated by the sudoku_bench program. Run
+#       sudoku_bench --dat before running this script.
 
 import os
 import matplotlib.pyplot as plt
@@ -22,6 +22,7 @@ TEST_DIR = os.path.join(ROOT_DIR, "test")
 BENCHMARK_DIR = os.path.join(TEST_DIR, "benchmarks")
 IMG_DIR = os.path.join(BENCHMARK_DIR, "img")
 DATA_DIR = os.path.join(BENCHMARK_DIR, "data")
+SCALING_DIR = os.path.join(DATA_DIR, "scaling")
 FILE_EXTENSION = ".dat"
 
 
@@ -91,13 +92,14 @@ def time_comparison():
 
     """
     if not os.path.exists(DATA_DIR):
-        print("No data directory found. Run the benchmark.sh first.")
+        print("No data directory found. Run sudoku_bench --dat first.")
         return
 
     folders = [
         folder
         for folder in os.listdir(DATA_DIR)
         if os.path.isdir(os.path.join(DATA_DIR, folder))
+        and os.path.join(DATA_DIR, folder) != SCALING_DIR
     ]
 
     for folder in folders:
@@ -124,7 +126,7 @@ def time_comparison():
 
         else:
             print(
-                f"No data files found in folder {folder}. Run the benchmark.sh first."
+                f"No data files found in folder {folder}. Run sudoku_bench --dat first."
             )
 
 
@@ -135,13 +137,14 @@ def expanded_states_comparison():
     """
 
     if not os.path.exists(DATA_DIR):
-        print("No data directory found. Run the benchmark.sh first.")
+        print("No data directory found. Run sudoku_bench --dat first.")
         return
 
     folders = [
         folder
         for folder in os.listdir(DATA_DIR)
         if os.path.isdir(os.path.join(DATA_DIR, folder))
+        and os.path.join(DATA_DIR, folder) != SCALING_DIR
     ]
 
     for folder in folders:
@@ -168,13 +171,74 @@ def expanded_states_comparison():
 
         else:
             print(
-                f"No data files found in folder {folder}. Run the benchmark.sh first."
+                f"No data files found in folder {folder}. Run sudoku_bench --dat first."
             )
 
 
+def scaling_comparison():
+    """
+    @brief Plot the speedup and efficiency of each scaling experiment
+
+    """
+    if not os.path.exists(SCALING_DIR):
+        return
+
+    # Files are <ALGORITHM>_<tier>_<scaling>.dat, and tiers may contain "_"
+    experiments = {}
+
+    for file in sorted(os.listdir(SCALING_DIR)):
+        if not file.endswith(FILE_EXTENSION):
+            continue
+
+        name = file[: -len(FILE_EXTENSION)]
+        algorithm, rest = name.split("_", 1)
+        tier, scaling = rest.rsplit("_", 1)
+
+        threads = read_data(os.path.join(SCALING_DIR, file), 0)[0]
+        speedup = read_data(os.path.join(SCALING_DIR, file), 2)[0]
+        efficiency = read_data(os.path.join(SCALING_DIR, file), 3)[0]
+
+        experiments.setdefault((tier, scaling), []).append(
+            (algorithm, threads, speedup, efficiency)
+        )
+
+    if not os.path.exists(IMG_DIR):
+        os.makedirs(IMG_DIR)
+
+    for (tier, scaling), series in experiments.items():
+        _, (speedup_axis, efficiency_axis) = plt.subplots(1, 2, figsize=(12, 5))
+
+        max_threads = max(max(threads) for _, threads, _, _ in series)
+
+        speedup_axis.plot([1, max_threads], [1, max_threads], "k--", label="Ideal")
+
+        for algorithm, threads, speedup, efficiency in series:
+            speedup_axis.plot(threads, speedup, marker="o", label=algorithm)
+            efficiency_axis.plot(threads, efficiency, marker="o", label=algorithm)
+
+        speedup_axis.set_xlabel("Threads")
+        speedup_axis.set_ylabel("Speedup")
+        speedup_axis.legend()
+
+        efficiency_axis.set_xlabel("Threads")
+        efficiency_axis.set_ylabel("Efficiency")
+        efficiency_axis.set_ylim(0, 1.1)
+        efficiency_axis.legend()
+
+        plt.suptitle(f"{scaling.capitalize()} scaling - {tier} level Sudoku")
+        plt.tight_layout()
+
+        img_name = f"{IMG_DIR}/{tier}_{scaling}_scaling.png"
+
+        plt.savefig(img_name)
+
+        print(f"Plot saved as {img_name}")
+
+
 def main():
     time_comparison()
     expanded_states_comparison()
+    scaling_comparison()
 
 
 if __name__ == "__main__":
@@ -0,0 +1,256 @@
+/*
+ * Filename: scaling.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "scaling.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include "board.h"
+
+namespace bench
+{
+    constexpr std::size_t MASK_CPUS = 64; /**< CPUs told apart by ParallelStats */
+
+    /**
+     * @brief Map each CPU to its NUMA node, from /sys/devices/system/node
+     * @return Node of each of the first MASK_CPUS CPUs, all 0 without sysfs
+     **/
+    static std::vector<std::size_t> ReadCpuNodes()
+    {
+        std::vector<std::size_t> nodes(MASK_CPUS, 0);
+        std::error_code          error;
+
+        std::filesystem::directory_iterator entries("/sys/devices/system/node", error);
+
+        if (error)
+            return nodes;
+
+        for (const std::filesystem::directory_entry& entry : entries)
+        {
+            std::string name = entry.path().filename().string();
+
+            if (name.compare(0, 4, "node") != 0 or name.size() == 4)
+                continue;
+
+            std::size_t   node = std::strtoull(name.c_str() + 4, nullptr, 10);
+            std::ifstream file(entry.path() / "cpulist");
+            std::string   list;
+
+            // Ranges such as 0-3,8-11
+            while (std::getline(file, list, ','))
+            {
+                char*       end;
+                std::size_t first = std::strtoull(list.c_str(), &end, 10);
+                std::size_t last  = first;
+
+                if (*end == '-')
+                    last = std::strtoull(end + 1, nullptr, 10);
+
+                for (std::size_t cpu = first; cpu <= last and cpu < MASK_CPUS; cpu++)
+                {
+                    nodes[cpu] = node;
+                }
+            }
+        }
+
+        return nodes;
+    }
+
+    /**
+     * @brief Get the node of each CPU, read once
+     * @return Node of each of the first MASK_CPUS CPUs
+     **/
+    static const std::vector<std::size_t>& CpuNodes()
+    {
+        static const std::vector<std::size_t> nodes = ReadCpuNodes();
+
+        return nodes;
+    }
+
+    /**
+     * @brief Count the NUMA nodes spanned by a mask of CPUs
+     * @param cpus Mask of the CPUs
+     * @return Number of distinct nodes
+     **/
+    static std::size_t NodesOf(uint64_t cpus)
+    {
+        uint64_t nodes = 0;
+
+        for (; cpus != 0; cpus &= cpus - 1)
+        {
+            nodes |= uint64_t(1) << (CpuNodes()[std::countr_zero(cpus)] % MASK_CPUS);
+        }
+
+        return std::popcount(nodes);
+    }
+
+    const char* ScalingName(Scaling scaling)
+    {
+        return scaling == Scaling::STRONG ? "strong" : "weak";
+    }
+
+    std::vector<std::size_t> ThreadCounts(std::size_t maxThreads)
+    {
+        std::vector<std::size_t> counts;
+
+        for (std::size_t threads = 1; threads < maxThreads; threads *= 2)
+        {
+            counts.push_back(threads);
+        }
+
+        counts.push_back(maxThreads);
+
+        return counts;
+    }
+
+    std::size_t NumaNodes()
+    {
+        std::size_t nodes = 1;
+
+        for (std::size_t node : CpuNodes())
+        {
+            nodes = std::max(nodes, node + 1);
+        }
+
+        return nodes;
+    }
+
+    std::vector<ScalingPoint> RunScaling(const Config&              config,
+                                         Scaling                    scaling,
+                                         Algorithm                  algorithm,
+                                         const std::vector<Puzzle>& puzzles,
+                                         std::size_t                maxThreads,
+                                         std::size_t                batch)
+    {
+        std::vector<ScalingPoint> points;
+        sudoku::SolverOptions     options = config.options;
+
+        for (std::size_t threads : ThreadCounts(maxThreads))
+        {
+            options.threads = threads;
+
+            std::size_t count =
+                scaling == Scaling::STRONG ? puzzles.size() : batch * threads;
+
+            ScalingPoint point = { threads, count, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+            std::vector<double> times;
+            uint64_t            cpus = 0;
+
+            for (std::size_t run = 0; run < config.warmup + config.repetitions; run++)
+            {
+                bool   measured = run >= config.warmup;
+                double time     = 0;
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    const Puzzle& puzzle = puzzles[i % puzzles.size()];
+
+                    uint16_t start[GRID_SIZE][GRID_SIZE];
+                    std::memcpy(start, puzzle.grid, sizeof(start));
+
+                    sudoku::Solver      solver(start, algorithm, options);
+                    sudoku::SolveResult result = solver.Run();
+
+                    if (not measured)
+                        continue;
+
+                    time += result.nanoseconds;
+                    point.offHome += result.parallel.offHome;
+                    point.contention += result.parallel.contention;
+                    cpus |= result.parallel.cpus;
+
+                    // Counted once, on the first measured run
+                    if (run == config.warmup and
+                        (not result.solved or
+                         (puzzle.hasExpected and
+                          std::memcmp(result.solution.cells,
+                                      puzzle.expected,
+                                      grid::BOARD_CELLS) != 0)))
+                        point.wrong++;
+                }
+
+                if (measured)
+                    times.push_back(time);
+            }
+
+            Summary summary = Summarize(times);
+
+            point.medianNs = summary.median;
+            point.madNs    = summary.mad;
+            point.offHome /= config.repetitions;
+            point.contention /= config.repetitions;
+            point.cpus  = std::popcount(cpus);
+            point.nodes = NodesOf(cpus);
+
+            if (not points.empty() and point.medianNs > 0)
+            {
+                // Weak scaling does threads times the work of the first step
+                double work = scaling == Scaling::STRONG ? 1 : threads;
+
+                point.speedup = work * points.front().medianNs / point.medianNs;
+            }
+            else
+            {
+                point.speedup = 1;
+            }
+
+            // The first step always runs a single thread
+            point.efficiency = point.speedup / threads;
+
+            points.push_back(point);
+        }
+
+        return points;
+    }
+
+    bool WriteScalingDat(const std::string&               directory,
+                         const std::string&               tier,
+                         Scaling                          scaling,
+                         Algorithm                        algorithm,
+                         const std::vector<ScalingPoint>& points)
+    {
+        std::filesystem::path folder = directory;
+        std::error_code       error;
+
+        folder /= "scaling";
+
+        std::filesystem::create_directories(folder, error);
+
+        std::filesystem::path path =
+            folder / (FileName(algorithm) + "_" + tier + "_" + ScalingName(scaling) +
+                      ".dat");
+
+        std::FILE* file = std::fopen(path.c_str(), "w");
+
+        if (file == nullptr)
+            return false;
+
+        for (const ScalingPoint& point : points)
+        {
+            std::fprintf(file,
+                         "%zu %.3f %.3f %.3f %.1f %.1f %zu %zu\n",
+                         point.threads,
+                         point.medianNs / 1e6,
+                         point.speedup,
+                         point.efficiency,
+                         point.offHome,
+                         point.contention,
+                         point.cpus,
+                         point.nodes);
+        }
+
+        std::fclose(file);
+
+        return true;
+    }
+} // namespace bench
@@ -0,0 +1,111 @@
+/*
+ * Filename: scaling.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef SCALING_H_
+#define SCALING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+
+namespace bench
+{
+    /**
+     * @brief Kind of scaling experiment
+     */
+    enum class Scaling
+    {
+        STRONG, /**< The same puzzles for every number of threads */
+        WEAK    /**< A batch of puzzles per thread */
+    };
+
+    /**
+     * @brief Measurements of an engine at one number of threads
+     */
+    struct ScalingPoint
+    {
+        std::size_t threads;    /**< Worker threads */
+        std::size_t puzzles;    /**< Puzzles solved by each run */
+        std::size_t wrong;      /**< Unsolved puzzles, or not matching the .out */
+        double      medianNs;   /**< Median time of a run */
+        double      madNs;      /**< Spread of the runs */
+        double      speedup;    /**< Strong: T1 / Tn. Weak: n T1 / Tn */
+        double      efficiency; /**< Speedup over the number of threads */
+        double      offHome;    /**< Subtrees run away from home, per run */
+        double      contention; /**< Failed updates of the winner, per run */
+        std::size_t cpus;       /**< Distinct CPUs the workers ran on */
+        std::size_t nodes;      /**< Distinct NUMA nodes of those CPUs */
+    };
+
+    /**
+     * @brief Get the name of a scaling experiment
+     * @param scaling Experiment to name
+     * @return strong or weak
+     **/
+    const char* ScalingName(Scaling scaling);
+
+    /**
+     * @brief Get the numbers of threads of an experiment: the powers of two up to
+     * maxThreads, and maxThreads itself
+     * @param maxThreads Largest number of threads
+     * @return Numbers of threads, increasing
+     **/
+    std::vector<std::size_t> ThreadCounts(std::size_t maxThreads);
+
+    /**
+     * @brief Count the NUMA nodes of the machine, from sysfs
+     * @return Number of nodes, 1 if the kernel does not expose them
+     **/
+    std::size_t NumaNodes();
+
+    /**
+     * @brief Run an engine at 1, 2, 4 ... maxThreads threads
+     *
+     * A run solves every puzzle once and its time is the sum of the search times.
+     * Strong scaling solves the given puzzles at every step, weak scaling solves
+     * batch puzzles per thread, cycling through the given ones. Speedup and
+     * efficiency are relative to the first step
+     *
+     * @param config Settings of the run. The number of threads is replaced
+     * @param scaling Experiment to run
+     * @param algorithm Engine to run
+     * @param puzzles Puzzles of the tier, at least one
+     * @param maxThreads Largest number of threads
+     * @param batch Puzzles per thread of the weak scaling
+     * @return One point per number of threads
+     **/
+    std::vector<ScalingPoint> RunScaling(const Config&              config,
+                                         Scaling                    scaling,
+                                         Algorithm                  algorithm,
+                                         const std::vector<Puzzle>& puzzles,
+                                         std::size_t                maxThreads,
+                                         std::size_t                batch);
+
+    /**
+     * @brief Write the points of an experiment for plot.py
+     *
+     * The points go to <directory>/scaling/<ALGORITHM>_<tier>_<scaling>.dat, one
+     * line per number of threads: threads, median time in milliseconds, speedup,
+     * efficiency, subtrees run away from home, contention, CPUs and NUMA nodes
+     *
+     * @param directory Root of the data folders
+     * @param tier Tier of the puzzles
+     * @param scaling Experiment that was run
+     * @param algorithm Engine that was run
+     * @param points Points to write
+     * @return False if the file cannot be written
+     **/
+    bool WriteScalingDat(const std::string&               directory,
+                         const std::string&               tier,
+                         Scaling                          scaling,
+                         Algorithm                        algorithm,
+                         const std::vector<ScalingPoint>& points);
+} // namespace bench
+
+#endif // SCALING_H_
@@ -0,0 +1,794 @@
+/*
+ * Filename: sudoku_bench.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ *
+ * In-process benchmark of the solver engines over the test/inputs tiers
+ */
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench.h"
+#include "compare.h"
+#include "kernels.h"
+#include "scaling.h"
+
+// Set by CMake, so the binary finds the inputs from any working directory
+#ifndef SUDOKU_SOURCE_DIR
+#define SUDOKU_SOURCE_DIR "."
+#endif
+
+/**
+ * @brief What to do with the results
+ */
+struct Reports
+{
+    std::string datDir;    /**< Folder of the .dat files, empty for none */
+    std::string jsonPath;  /**< JSON file, empty for none */
+    std::string baseline;  /**< JSON file to compare with, empty for none */
+    double      tolerance; /**< Relative change in time that is accepted */
+    bool        timing;    /**< Compare the times, not only the counts */
+};
+
+/**
+ * @brief Scaling experiment run instead of the tiers, if any
+ */
+struct ScalingRun
+{
+    bool           enabled;    /**< Run the experiment */
+    bench::Scaling scaling;    /**< Strong or weak */
+    std::size_t    maxThreads; /**< Largest number of threads */
+    std::size_t    batch;      /**< Puzzles per thread of the weak scaling */
+};
+
+void HelpMessage(const char* program)
+{
+    std::fprintf(stderr, "Usage: %s [options]\n", program);
+    std::fprintf(stderr, "Options:\n");
+    std::fprintf(stderr, "\t--tiers=<a,b,...>     tiers to run, all by default\n");
+    std::fprintf(stderr,
+                 "\t--algorithms=<letters> engines to run, default %s\n",
+                 bench::ALGORITHMS);
+    std::fprintf(stderr, "\t--cases=<n>           puzzles per tier, at most\n");
+    std::fprintf(stderr, "\t--warmup=<n>          unmeasured runs per puzzle (1)\n");
+    std::fprintf(stderr, "\t--repetitions=<n>     measured runs per puzzle (5)\n");
+    std::fprintf(stderr, "\t--inputs=<dir>        folder with one folder per tier\n");
+    std::fprintf(stderr, "\t--dat[=<dir>]         write the .dat files of plot.py\n");
+    std::fprintf(stderr, "\t--json=<file>         write the results as JSON\n");
+    std::fprintf(stderr, "\t--compare=<file>      compare with a JSON baseline, using its\n");
+    std::fprintf(stderr, "\t                      settings, and fail on regressions\n");
+    std::fprintf(stderr, "\t--tolerance=<pct>     accepted change in time (10)\n");
+    std::fprintf(stderr, "\t--counts-only         compare only counts and solutions\n");
+    std::fprintf(stderr, "\t--seed=<n>            seed of every solver (1)\n");
+    std::fprintf(stderr, "\t--perf-counters       count hardware events per group\n");
+    std::fprintf(stderr, "\t--histograms          tree shape of each group\n");
+    std::fprintf(stderr, "\t--scaling=<kind>      strong or weak scaling of the\n");
+    std::fprintf(stderr, "\t                      engines, P over super_hard\n");
+    std::fprintf(stderr, "\t                      (strong) or hard (weak) if not\n");
+    std::fprintf(stderr, "\t                      given\n");
+    std::fprintf(stderr, "\t--max-threads=<n>     threads of the last step (CPUs)\n");
+    std::fprintf(stderr, "\t--batch=<n>           puzzles per thread if weak (4)\n");
+    std::fprintf(stderr, "\t--propagate, --threads=<n>, --deterministic and\n");
+    std::fprintf(stderr, "\t--iterations=<n>      as in sudoku_solver\n");
+}
+
+/**
+ * @brief Parse an integer option given as --name=value
+ * @param option Option to parse
+ * @param name Name of the option, including the dashes and the '='
+ * @param value Receives the value
+ * @return True if the option has this name and a valid value
+ **/
+bool ParseNumber(const char* option, const char* name, std::size_t& value)
+{
+    std::size_t length = std::strlen(name);
+
+    if (std::strncmp(option, name, length) != 0)
+        return false;
+
+    char* end;
+    value = std::strtoull(option + length, &end, 10);
+
+    return *end == '\0' and end != option + length;
+}
+
+/**
+ * @brief Parse the options of the benchmark
+ * @param argc Number of arguments
+ * @param argv Arguments
+ * @param config Receives the settings
+ * @param reports Receives what to do with the results
+ * @param scaling Receives the scaling experiment
+ * @return True if every option is valid
+ **/
+bool ParseOptions(int            argc,
+                  char*          argv[],
+                  bench::Config& config,
+                  Reports&       reports,
+                  ScalingRun&    scaling)
+{
+    std::size_t seed = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* option = argv[i];
+
+        if (std::strncmp(option, "--tiers=", 8) == 0)
+        {
+            config.tiers.clear();
+
+            std::string list  = option + 8;
+            std::size_t start = 0;
+
+            while (start <= list.size())
+            {
+                std::size_t comma = list.find(',', start);
+
+                if (comma == std::string::npos)
+                    comma = list.size();
+
+                if (comma > start)
+                    config.tiers.push_back(list.substr(start, comma - start));
+
+                start = comma + 1;
+            }
+
+            if (config.tiers.empty())
+                return false;
+        }
+        else if (std::strncmp(option, "--algorithms=", 13) == 0)
+        {
+            config.algorithms = option + 13;
+
+            if (config.algorithms.empty())
+                return false;
+
+            for (char letter : config.algorithms)
+            {
+                if (std::strchr(bench::ALGORITHMS, letter) == nullptr)
+                    return false;
+            }
+        }
+        else if (std::strncmp(option, "--inputs=", 9) == 0)
+        {
+            config.inputDir = option + 9;
+        }
+        else if (std::strcmp(option, "--dat") == 0)
+        {
+            reports.datDir = SUDOKU_SOURCE_DIR "/test/benchmarks/data";
+        }
+        else if (std::strncmp(option, "--dat=", 6) == 0)
+        {
+            reports.datDir = option + 6;
+        }
+        else if (std::strncmp(option, "--json=", 7) == 0)
+        {
+            reports.jsonPath = option + 7;
+        }
+        else if (std::strncmp(option, "--compare=", 10) == 0)
+        {
+            reports.baseline = option + 10;
+        }
+        else if (std::strncmp(option, "--tolerance=", 12) == 0)
+        {
+            char* end;
+            reports.tolerance = std::strtod(option + 12, &end) / 100;
+
+            if (*end != '\0' or end == option + 12 or reports.tolerance < 0)
+                return false;
+        }
+        else if (std::strcmp(option, "--counts-only") == 0)
+        {
+            reports.timing = false;
+        }
+        else if (std::strcmp(option, "--scaling=strong") == 0)
+        {
+            scaling.enabled = true;
+            scaling.scaling = bench::Scaling::STRONG;
+        }
+        else if (std::strcmp(option, "--scaling=weak") == 0)
+        {
+            scaling.enabled = true;
+            scaling.scaling = bench::Scaling::WEAK;
+        }
+        else if (std::strcmp(option, "--propagate") == 0)
+        {
+            config.options.propagate = true;
+        }
+        else if (std::strcmp(option, "--deterministic") == 0)
+        {
+            config.options.deterministic = true;
+        }
+        else if (std::strcmp(option, "--perf-counters") == 0)
+        {
+            config.options.perfCounters = true;
+        }
+        else if (std::strcmp(option, "--histograms") == 0)
+        {
+            config.options.histograms = true;
+        }
+        else if (not ParseNumber(option, "--cases=", config.cases) and
+                 not ParseNumber(option, "--warmup=", config.warmup) and
+                 not ParseNumber(option, "--repetitions=", config.repetitions) and
+                 not ParseNumber(option, "--threads=", config.options.threads) and
+                 not ParseNumber(option, "--iterations=", config.options.iterations) and
+                 not ParseNumber(option, "--max-threads=", scaling.maxThreads) and
+                 not ParseNumber(option, "--batch=", scaling.batch) and
+                 not ParseNumber(option, "--seed=", seed))
+        {
+            return false;
+        }
+    }
+
+    config.options.seed = seed;
+
+    // A seed of 0 would be replaced by the clock, and the runs would differ
+    return config.repetitions > 0 and config.options.threads > 0 and seed > 0 and
+           scaling.maxThreads > 0 and scaling.batch > 0;
+}
+
+/**
+ * @brief Print the hardware events of each group, per run and per thousand
+ * instructions
+ * @param groups Results of the run
+ **/
+void PrintCounters(const std::vector<bench::GroupResult>& groups)
+{
+    std::printf("\nHardware counters (calling thread only)\n");
+    std::printf("%-10s %-12s %14s %6s %8s %8s %8s %8s\n",
+                "tier",
+                "algorithm",
+                "cycles/run",
+                "ipc",
+                "l1d/ki",
+                "llc/ki",
+                "br/ki",
+                "dtlb/ki");
+
+    for (const bench::GroupResult& group : groups)
+    {
+        const perf::Sample& counters     = group.counters;
+        double              instructions = counters.values[perf::INSTRUCTIONS];
+        double              cycles       = counters.values[perf::CYCLES];
+
+        std::printf(
+            "%-10s %-12s", group.tier.c_str(), sudoku::AlgorithmName(group.algorithm));
+
+        // Each column needs its own event, and the ratios need the instructions
+        char column[32];
+
+        for (std::size_t event = 0; event < perf::EVENTS; event++)
+        {
+            bool        available = counters.available[event];
+            double      value     = counters.values[event];
+            int         width     = 8;
+            const char* format    = "%.2f";
+
+            if (event == perf::CYCLES)
+            {
+                value  = group.runs > 0 ? value / group.runs : 0;
+                width  = 14;
+                format = "%.0f";
+            }
+            else if (event == perf::INSTRUCTIONS)
+            {
+                available = available and counters.available[perf::CYCLES];
+                value     = value / std::max(1.0, cycles);
+                width     = 6;
+            }
+            else
+            {
+                available = available and counters.available[perf::INSTRUCTIONS];
+                value     = 1000 * value / std::max(1.0, instructions);
+            }
+
+            if (available)
+                std::snprintf(column, sizeof(column), format, value);
+            else
+                std::snprintf(column, sizeof(column), "-");
+
+            std::printf(" %*s", width, column);
+        }
+
+        std::printf("\n");
+    }
+}
+
+/**
+ * @brief Print the heap allocations of each group
+ * @param groups Results of the run
+ **/
+void PrintAllocations(const std::vector<bench::GroupResult>& groups)
+{
+    std::printf("\nHeap allocations (calling thread only)\n");
+    std::printf("%-10s %-12s %12s %12s %14s %14s\n",
+                "tier",
+                "algorithm",
+                "allocs/run",
+                "per_state",
+                "bytes/run",
+                "peak_live");
+
+    for (const bench::GroupResult& group : groups)
+    {
+        double runs = std::max<std::size_t>(group.runs, 1);
+
+        std::printf("%-10s %-12s %12.1f %12.4f %14.0f %14lu\n",
+                    group.tier.c_str(),
+                    sudoku::AlgorithmName(group.algorithm),
+                    group.allocations.allocations / runs,
+                    static_cast<double>(group.allocations.allocations) /
+                        std::max<std::size_t>(group.expanded, 1),
+                    group.allocations.bytes / runs,
+                    group.peakLive);
+    }
+}
+
+/**
+ * @brief Print a row of the latency table
+ * @param tier Tier of the runs, or "all"
+ * @param algorithm Engine of the runs
+ * @param histogram Times of the runs
+ **/
+void PrintLatencyRow(const char*               tier,
+                     Algorithm                 algorithm,
+                     const latency::Histogram& histogram)
+{
+    latency::Percentiles summary = histogram.Summary();
+
+    std::printf("%-10s %-12s %8lu %12lu %12lu %12lu %12lu %12lu\n",
+                tier,
+                sudoku::AlgorithmName(algorithm),
+                summary.count,
+                summary.p50,
+                summary.p90,
+                summary.p99,
+                summary.p999,
+                summary.max);
+}
+
+/**
+ * @brief Print the percentiles of every measured run, per group and per engine
+ * @param groups Results of the run
+ **/
+void PrintLatency(const std::vector<bench::GroupResult>& groups)
+{
+    std::printf("\nLatency of every measured run (ns)\n");
+    std::printf("%-10s %-12s %8s %12s %12s %12s %12s %12s\n",
+                "tier",
+                "algorithm",
+                "runs",
+                "p50",
+                "p90",
+                "p99",
+                "p99.9",
+                "max");
+
+    std::string engines;
+
+    for (const bench::GroupResult& group : groups)
+    {
+        PrintLatencyRow(group.tier.c_str(), group.algorithm, group.latency);
+
+        if (engines.find(static_cast<char>(group.algorithm)) == std::string::npos)
+            engines += static_cast<char>(group.algorithm);
+    }
+
+    // Every tier of an engine merged, when there is more than one
+    for (char letter : engines)
+    {
+        latency::Histogram merged;
+        std::size_t        tiers = 0;
+
+        for (const bench::GroupResult& group : groups)
+        {
+            if (static_cast<char>(group.algorithm) != letter)
+                continue;
+
+            merged.Merge(group.latency);
+            tiers++;
+        }
+
+        if (tiers > 1)
+            PrintLatencyRow("all", static_cast<Algorithm>(letter), merged);
+    }
+}
+
+/**
+ * @brief Print the shape of the search tree of each group, averaged per run
+ * @param groups Results of the run
+ **/
+void PrintShapes(const std::vector<bench::GroupResult>& groups)
+{
+    for (const bench::GroupResult& group : groups)
+    {
+        // The local search has no tree
+        if (group.shape.Depths() == 0)
+            continue;
+
+        std::printf("\nTree shape of %s on %s (per run)\n",
+                    sudoku::AlgorithmName(group.algorithm),
+                    group.tier.c_str());
+        shape::Print(group.shape, group.runs);
+    }
+}
+
+/**
+ * @brief Check if a group is part of a baseline
+ * @param baseline Groups of the baseline
+ * @param tier Tier of the group
+ * @param algorithm Engine of the group
+ * @return True if the baseline has the group
+ **/
+bool InBaseline(const std::vector<bench::GroupResult>& baseline,
+                const std::string&                     tier,
+                Algorithm                              algorithm)
+{
+    for (const bench::GroupResult& group : baseline)
+    {
+        if (group.tier == tier and group.algorithm == algorithm)
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Adopt the settings and groups of a baseline, so the counts are comparable
+ * @param baseline Groups of the baseline
+ * @param config Settings of the run, updated in place
+ **/
+void FollowBaseline(const std::vector<bench::GroupResult>& baseline,
+                    bench::Config&                         config)
+{
+    config.tiers.clear();
+    config.algorithms.clear();
+    config.cases = 0;
+
+    for (const bench::GroupResult& group : baseline)
+    {
+        if (std::find(config.tiers.begin(), config.tiers.end(), group.tier) ==
+            config.tiers.end())
+            config.tiers.push_back(group.tier);
+
+        if (config.algorithms.find(static_cast<char>(group.algorithm)) ==
+            std::string::npos)
+            config.algorithms.push_back(static_cast<char>(group.algorithm));
+
+        // Puzzles are sorted by name, so the baseline ran the first ones
+        config.cases = std::max(config.cases, group.cases.size());
+    }
+}
+
+/**
+ * @brief Print the comparison with a baseline
+ * @param comparisons Comparison of each group
+ * @param reports Settings of the comparison
+ * @return Number of groups that failed
+ **/
+std::size_t PrintComparison(const std::vector<bench::Comparison>& comparisons,
+                            const Reports&                        reports)
+{
+    std::size_t failures = 0;
+
+    std::printf("\nComparison with %s (tolerance %.0f%%, significance %.2f%s)\n",
+                reports.baseline.c_str(),
+                reports.tolerance * 100,
+                bench::SIGNIFICANCE,
+                reports.timing ? "" : ", counts only");
+    std::printf("%-10s %-12s %6s %8s %6s %6s %10s %9s  %s\n",
+                "tier",
+                "algorithm",
+                "cases",
+                "expanded",
+                "lost",
+                "wrong",
+                "time",
+                "p-value",
+                "verdict");
+
+    for (const bench::Comparison& comparison : comparisons)
+    {
+        char pValue[16] = "-";
+
+        if (not std::isnan(comparison.pValue))
+            std::snprintf(pValue, sizeof(pValue), "%.4f", comparison.pValue);
+
+        std::printf("%-10s %-12s %6zu %8zu %6zu %6zu %+9.1f%% %9s  %s\n",
+                    comparison.tier.c_str(),
+                    sudoku::AlgorithmName(comparison.algorithm),
+                    comparison.cases,
+                    comparison.changed,
+                    comparison.lost,
+                    comparison.wrong,
+                    (comparison.ratio - 1) * 100,
+                    pValue,
+                    bench::VerdictName(comparison.verdict));
+
+        for (const std::string& detail : comparison.details)
+        {
+            std::printf("    %s\n", detail.c_str());
+        }
+
+        if (bench::IsFailure(comparison.verdict))
+            failures++;
+    }
+
+    return failures;
+}
+
+/**
+ * @brief Run the scaling experiment of each engine over each tier and print it
+ * @param config Settings of the run
+ * @param reports What to do with the results, only the .dat files are used
+ * @param scaling Experiment to run
+ * @return Exit status of the benchmark
+ **/
+int RunScaling(const bench::Config& config,
+               const Reports&       reports,
+               const ScalingRun&    scaling)
+{
+    std::printf("Scaling: %s, kernel: %s, NUMA nodes: %zu, warm-up: %zu, "
+                "repetitions: %zu, seed: %" PRIu64 "\n\n",
+                bench::ScalingName(scaling.scaling),
+                kernel::Active().name,
+                bench::NumaNodes(),
+                config.warmup,
+                config.repetitions,
+                config.options.seed);
+    std::printf("%-10s %-12s %7s %7s %6s %12s %12s %8s %6s %8s %10s %4s %5s\n",
+                "tier",
+                "algorithm",
+                "threads",
+                "puzzles",
+                "wrong",
+                "median_ns",
+                "mad_ns",
+                "speedup",
+                "eff",
+                "off_home",
+                "contention",
+                "cpus",
+                "nodes");
+
+    bool failed = false;
+
+    for (const std::string& tier : config.tiers)
+    {
+        std::vector<bench::Puzzle> puzzles;
+
+        if (not bench::LoadTier(config.inputDir + "/" + tier, puzzles) or
+            puzzles.empty())
+        {
+            std::fprintf(stderr, "Cannot load the tier %s\n", tier.c_str());
+            return EXIT_FAILURE;
+        }
+
+        if (puzzles.size() > config.cases)
+            puzzles.resize(config.cases);
+
+        for (char letter : config.algorithms)
+        {
+            Algorithm algorithm = static_cast<Algorithm>(letter);
+
+            std::vector<bench::ScalingPoint> points =
+                bench::RunScaling(config,
+                                  scaling.scaling,
+                                  algorithm,
+                                  puzzles,
+                                  scaling.maxThreads,
+                                  scaling.batch);
+
+            for (const bench::ScalingPoint& point : points)
+            {
+                std::printf("%-10s %-12s %7zu %7zu %6zu %12.0f %12.0f %8.2f %6.2f "
+                            "%8.1f %10.1f %4zu %5zu\n",
+                            tier.c_str(),
+                            sudoku::AlgorithmName(algorithm),
+                            point.threads,
+                            point.puzzles,
+                            point.wrong,
+                            point.medianNs,
+                            point.madNs,
+                            point.speedup,
+                            point.efficiency,
+                            point.offHome,
+                            point.contention,
+                            point.cpus,
+                            point.nodes);
+
+                failed = failed or point.wrong > 0;
+            }
+
+            std::fflush(stdout);
+
+            if (not reports.datDir.empty() and
+                not bench::WriteScalingDat(
+                    reports.datDir, tier, scaling.scaling, algorithm, points))
+            {
+                std::fprintf(stderr,
+                             "Cannot write the .dat files in %s\n",
+                             reports.datDir.c_str());
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+int main(int argc, char* argv[])
+{
+    bench::Config config;
+    config.inputDir    = SUDOKU_SOURCE_DIR "/test/inputs";
+    config.warmup      = 1;
+    config.repetitions = 5;
+    config.cases       = SIZE_MAX;
+
+    Reports    reports = { "", "", "", 0.1, true };
+    ScalingRun scaling = { false,
+                           bench::Scaling::STRONG,
+                           std::max(std::thread::hardware_concurrency(), 1u),
+                           4 };
+
+    if (not ParseOptions(argc, argv, config, reports, scaling))
+    {
+        HelpMessage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (scaling.enabled)
+    {
+        if (not reports.jsonPath.empty() or not reports.baseline.empty())
+        {
+            std::fprintf(stderr, "--json and --compare do not apply to --scaling\n");
+            return EXIT_FAILURE;
+        }
+
+        // Strong scaling needs a single long search, weak scaling many of them
+        if (config.tiers.empty())
+            config.tiers = { scaling.scaling == bench::Scaling::STRONG ? "super_hard"
+                                                                       : "hard" };
+
+        if (config.algorithms.empty())
+            config.algorithms = "P";
+
+        return RunScaling(config, reports, scaling);
+    }
+
+    if (config.tiers.empty())
+        config.tiers.assign(std::begin(bench::TIERS), std::end(bench::TIERS));
+
+    if (config.algorithms.empty())
+        config.algorithms = bench::ALGORITHMS;
+
+    std::vector<bench::GroupResult> baseline;
+
+    if (not reports.baseline.empty())
+    {
+        if (not bench::ReadResults(reports.baseline, config, baseline))
+        {
+            std::fprintf(
+                stderr, "Cannot read the baseline %s\n", reports.baseline.c_str());
+            return EXIT_FAILURE;
+        }
+
+        FollowBaseline(baseline, config);
+    }
+
+    std::printf("Kernel: %s, warm-up: %zu, repetitions: %zu, seed: %" PRIu64 "\n\n",
+                kernel::Active().name,
+                config.warmup,
+                config.repetitions,
+                config.options.seed);
+    std::printf("%-10s %-12s %6s %6s %6s %12s %12s %12s %12s %12s\n",
+                "tier",
+                "algorithm",
+                "cases",
+                "solved",
+                "wrong",
+                "median_ns",
+                "mad_ns",
+                "p90_ns",
+                "p99_ns",
+                "puzzles/s");
+
+    std::vector<bench::GroupResult> groups;
+
+    for (const std::string& tier : config.tiers)
+    {
+        std::vector<bench::Puzzle> puzzles;
+
+        if (not bench::LoadTier(config.inputDir + "/" + tier, puzzles))
+        {
+            std::fprintf(stderr, "Cannot load the tier %s\n", tier.c_str());
+            return EXIT_FAILURE;
+        }
+
+        if (puzzles.size() > config.cases)
+            puzzles.resize(config.cases);
+
+        for (char letter : config.algorithms)
+        {
+            Algorithm algorithm = static_cast<Algorithm>(letter);
+
+            if (not baseline.empty() and not InBaseline(baseline, tier, algorithm))
+                continue;
+
+            bench::GroupResult group =
+                bench::RunGroup(config, tier, algorithm, puzzles);
+
+            std::printf(
+                "%-10s %-12s %6zu %6zu %6zu %12.0f %12.0f %12.0f %12.0f %12.1f\n",
+                tier.c_str(),
+                sudoku::AlgorithmName(algorithm),
+                group.cases.size(),
+                group.solved,
+                group.wrong,
+                group.summary.median,
+                group.summary.mad,
+                group.summary.p90,
+                group.summary.p99,
+                group.puzzlesPerSecond);
+            std::fflush(stdout);
+
+            groups.push_back(group);
+        }
+    }
+
+    PrintLatency(groups);
+
+    if (config.options.perfCounters)
+        PrintCounters(groups);
+
+    if (alloc::ENABLED)
+        PrintAllocations(groups);
+
+    if (config.options.histograms)
+        PrintShapes(groups);
+
+    if (not reports.datDir.empty() and not bench::WriteDat(reports.datDir, groups))
+    {
+        std::fprintf(
+            stderr, "Cannot write the .dat files in %s\n", reports.datDir.c_str());
+        return EXIT_FAILURE;
+    }
+
+    if (not reports.jsonPath.empty() and
+        not bench::WriteJson(reports.jsonPath, config, groups))
+    {
+        std::fprintf(stderr, "Cannot write %s\n", reports.jsonPath.c_str());
+        return EXIT_FAILURE;
+    }
+
+    if (not baseline.empty())
+    {
+        std::vector<bench::Comparison> comparisons =
+            bench::Compare(baseline, groups, reports.tolerance, reports.timing);
+
+        std::size_t failures = PrintComparison(comparisons, reports);
+
+        std::printf("\n%zu of %zu groups failed\n", failures, comparisons.size());
+
+        if (failures > 0)
+            return EXIT_FAILURE;
+    }
+
+    // Wrong solutions are a failure even without a baseline
+    for (const bench::GroupResult& group : groups)
+    {
+        if (group.wrong > 0)
+            return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+/*
+ * Filename: annealing_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "annealing.h"
+#include "doctest.h"
+
+/**
+ * @brief Build a solved classic grid of any box side
+ * @param boxSide Side of a box
+ * @return Cells in row-major order
+ **/
+static std::vector<uint8_t> SolvedGrid(uint16_t boxSide)
+{
+    uint16_t             side = boxSide * boxSide;
+    std::vector<uint8_t> cells(side * side);
+
+    for (uint16_t row = 0; row < side; row++)
+    {
+        for (uint16_t col = 0; col < side; col++)
+        {
+            cells[row * side + col] =
+                (boxSide * (row % boxSide) + row / boxSide + col) % side + 1;
+        }
+    }
+
+    return cells;
+}
+
+TEST_CASE("Annealing solves a grid whose free cells are all in one region")
+{
+    // Only the first box has free cells, so a region picked at random has no move
+    // most of the time
+    for (uint16_t boxSide : { 3, 4, 5 })
+    {
+        uint16_t             side  = boxSide * boxSide;
+        std::vector<uint8_t> cells = SolvedGrid(boxSide);
+
+        for (uint16_t row = 0; row < boxSide; row++)
+        {
+            cells[row * side + row] = 0;
+        }
+
+        for (uint32_t seed = 1; seed <= 100; seed++)
+        {
+            annealing::Annealer annealer(boxSide, cells, seed);
+
+            CHECK(annealer.Run(1000000));
+            CHECK(annealer.Conflicts() == 0);
+        }
+    }
+}
+
+TEST_CASE("Annealing uses the whole budget while a move exists")
+{
+    std::vector<uint8_t> cells = SolvedGrid(3);
+
+    // Two free cells in the first box, and a given repeated in the last row, so
+    // the conflicts never reach zero
+    cells[0]     = 0;
+    cells[10]    = 0;
+    cells[8 * 9] = cells[8 * 9 + 1];
+
+    for (uint32_t seed = 1; seed <= 20; seed++)
+    {
+        annealing::Annealer annealer(3, cells, seed);
+
+        CHECK_FALSE(annealer.Run(100000));
+        CHECK(annealer.Iterations() == 100000);
+    }
+}
+
+TEST_CASE("Annealing stops at once when no move exists")
+{
+    std::vector<uint8_t> cells = SolvedGrid(3);
+
+    // At most one free cell per box, so every region is decided, and a given
+    // repeated in the last row leaves conflicts that no move can fix
+    cells[0]     = 0;
+    cells[40]    = 0;
+    cells[8 * 9] = cells[8 * 9 + 1];
+
+    annealing::Annealer annealer(3, cells, 1);
+
+    CHECK_FALSE(annealer.Run(100000));
+    CHECK(annealer.Conflicts() > 0);
+    CHECK(annealer.Iterations() == 0);
+}